@@ -0,0 +1,302 @@
+/****************************************************************************
+ * @file    DEBOUNCE.c
+ * @author  Boles Medhat
+ * @brief   Input Debouncer Source File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a debouncer for up to 32 buttons or switches on any pins of
+ * DIO_PORTA to DIO_PORTD, sampled from a timer interrupt every 1, 2, 5 or 10 ms.
+ * The 8 pins of a port are debounced together with 2-bit vertical counters, so each
+ * port takes a few byte operations per tick.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: With DEBOUNCE_TIMER0 or DEBOUNCE_TIMER2 you must initialize the timer
+ * 				   in CTC mode with the compare match interrupt enabled **before** calling
+ *	 	 	 	   DEBOUNCE_Init(). This driver does not initialize the timer internally.
+ * - With DEBOUNCE_TIMER_MANUAL call DEBOUNCE_Tick() every DEBOUNCE_TICK_MS from your own timer interrupt.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "DEBOUNCE.h"
+
+
+/* Debounced Pins of each Port */
+const uint8 DEBOUNCE_PortPins[ DEBOUNCE_PORTS_NUM ] = { DEBOUNCE_PORTA_PINS , DEBOUNCE_PORTB_PINS , DEBOUNCE_PORTC_PINS , DEBOUNCE_PORTD_PINS };
+
+
+/* Debounced State of each Port (bit set for a pressed input) */
+volatile uint8 DEBOUNCE_State[ DEBOUNCE_PORTS_NUM ];
+
+
+/* Vertical Counters of each Port (bit n of both bytes is the 2-bit counter of pin n) */
+uint8 DEBOUNCE_Counter0[ DEBOUNCE_PORTS_NUM ];
+uint8 DEBOUNCE_Counter1[ DEBOUNCE_PORTS_NUM ];
+
+
+/* Hold Steps of each Pressed Input for the Long Press Event */
+uint8 DEBOUNCE_HoldSteps[ DEBOUNCE_INPUTS_NUM ];
+
+
+/* Event Queue (written by the Interrupt, read by the Application) */
+uint8 DEBOUNCE_Queue[ DEBOUNCE_QUEUE_SIZE ];
+volatile uint8 DEBOUNCE_QueueHead = 0;
+volatile uint8 DEBOUNCE_QueueTail = 0;
+
+
+
+
+
+/*
+ * @brief Adds an event to the event queue.
+ *
+ * This function is not intended for direct use by the user. It is called from the
+ * sampling interrupt, the event is lost if the queue is full.
+ *
+ * @param event: The event type ORed with the input number.
+ */
+static void DEBOUNCE_QueuePush( uint8 event )
+{
+
+	/* Get the Next Head Position */
+	uint8 next_head = ( DEBOUNCE_QueueHead + 1 ) & ( DEBOUNCE_QUEUE_SIZE - 1 );
+
+	/* Check if the Queue is not Full */
+	if( next_head != DEBOUNCE_QueueTail )
+	{
+		DEBOUNCE_Queue[ DEBOUNCE_QueueHead ] = event;
+		DEBOUNCE_QueueHead = next_head;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Queues an event for each set bit of a pin mask.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param event_type: DEBOUNCE_EVENT_PRESS or DEBOUNCE_EVENT_RELEASE.
+ * @param port:       Port index (0 to 3).
+ * @param pins:       The pins that generate the event.
+ */
+static void DEBOUNCE_QueuePins( uint8 event_type , uint8 port , uint8 pins )
+{
+
+	/* Loop on the Set Bits Only */
+	for( uint8 pin = 0 ; pins != 0 ; pin++ , pins >>= 1 )
+	{
+		if( pins & 1 )
+		{
+			/* A New Press Starts Counting the Hold Time Again */
+			DEBOUNCE_HoldSteps[ DEBOUNCE_INPUT( port , pin ) ] = 0;
+
+			DEBOUNCE_QueuePush( event_type | DEBOUNCE_INPUT( port , pin ) );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initializes the debounced pins and starts sampling them.
+ *
+ * This function sets the debounced pins as inputs (with the internal pull-ups for
+ * DEBOUNCE_ACTIVE_LOW), takes their current levels as the debounced state so no
+ * event is generated for the inputs already pressed, and sets the timer callback.
+ */
+void DEBOUNCE_Init( void )
+{
+
+	/* Loop on the Ports that have Debounced Pins */
+	for( uint8 port = 0 ; port < DEBOUNCE_PORTS_NUM ; port++ )
+	{
+		if( DEBOUNCE_PortPins[ port ] != 0 )
+		{
+			DIO_PinGroup inputs = { port , DEBOUNCE_PortPins[ port ] };
+
+			/* Set the Debounced Pins as Input */
+			#if DEBOUNCE_ACTIVE_LEVEL == DEBOUNCE_ACTIVE_LOW
+				DIO_SetPinGroupDirection( &inputs , INPUT_PULLUP );
+			#else
+				DIO_SetPinGroupDirection( &inputs , INPUT );
+			#endif
+		}
+
+		/* Reset the Vertical Counters to their Start Value */
+		DEBOUNCE_Counter0[ port ] = 0xFF;
+		DEBOUNCE_Counter1[ port ] = 0xFF;
+	}
+
+	/* Wait for the Pull-Ups to Charge the Input Lines */
+	_delay_us( 10 );
+
+	/* Take the Current Levels as the Debounced State */
+	for( uint8 port = 0 ; port < DEBOUNCE_PORTS_NUM ; port++ )
+	{
+		#if DEBOUNCE_ACTIVE_LEVEL == DEBOUNCE_ACTIVE_LOW
+			DEBOUNCE_State[ port ] = ~DIO_PIN_REG( port ) & DEBOUNCE_PortPins[ port ];
+		#else
+			DEBOUNCE_State[ port ] =  DIO_PIN_REG( port ) & DEBOUNCE_PortPins[ port ];
+		#endif
+	}
+
+	/* Set the Timer Compare Match Interrupt Callback to Sample the Inputs */
+	#if   DEBOUNCE_TIMER == DEBOUNCE_TIMER0
+		TIMER0_SetCallback( TIMER0_COMP_ID , & DEBOUNCE_Tick );
+	#elif DEBOUNCE_TIMER == DEBOUNCE_TIMER2
+		TIMER2_SetCallback( TIMER2_COMP_ID , & DEBOUNCE_Tick );
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Samples all the debounced pins and queues their events.
+ *
+ * This function is called every DEBOUNCE_TICK_MS by the timer compare match interrupt.
+ * With DEBOUNCE_TIMER_MANUAL call it from your own periodic interrupt instead.
+ *
+ * Each port is debounced in parallel with two vertical counter bytes: a pin changes its
+ * debounced state after 4 equal samples that differ from it.
+ */
+void DEBOUNCE_Tick( void )
+{
+
+	/* Ticks Counter for the Hold Steps */
+	static uint8 hold_ticks = 0;
+
+	uint8 changed;
+	uint8 state;
+	uint8 counter0;
+	uint8 counter1;
+
+
+	/* Loop on the Ports that have Debounced Pins */
+	for( uint8 port = 0 ; port < DEBOUNCE_PORTS_NUM ; port++ )
+	{
+		if( DEBOUNCE_PortPins[ port ] == 0 )
+		{
+			continue;
+		}
+
+		state = DEBOUNCE_State[ port ];
+
+		/* Get the Pins that Differ from the Debounced State */
+		#if DEBOUNCE_ACTIVE_LEVEL == DEBOUNCE_ACTIVE_LOW
+			changed = ( ~DIO_PIN_REG( port ) & DEBOUNCE_PortPins[ port ] ) ^ state;
+		#else
+			changed = (  DIO_PIN_REG( port ) & DEBOUNCE_PortPins[ port ] ) ^ state;
+		#endif
+
+		/* Count Down the Counters of the Changed Pins, Reset the Others to their Start Value */
+		counter0 = ~( DEBOUNCE_Counter0[ port ] & changed );
+		counter1 = counter0 ^ ( DEBOUNCE_Counter1[ port ] & changed );
+		DEBOUNCE_Counter0[ port ] = counter0;
+		DEBOUNCE_Counter1[ port ] = counter1;
+
+		/* Keep the Pins that Changed for 4 Samples (their Counter Rolled Over) */
+		changed &= counter0 & counter1;
+
+		if( changed != 0 )
+		{
+			/* Toggle the Debounced State of the Pins */
+			state ^= changed;
+			DEBOUNCE_State[ port ] = state;
+
+			/* Queue the Press and Release Events */
+			DEBOUNCE_QueuePins( DEBOUNCE_EVENT_PRESS   , port , changed &  state );
+			DEBOUNCE_QueuePins( DEBOUNCE_EVENT_RELEASE , port , changed & ~state );
+		}
+	}
+
+
+	/* Count the Hold Time of the Pressed Inputs every Hold Step */
+	if( ++hold_ticks >= DEBOUNCE_HOLD_STEP_TICKS )
+	{
+		hold_ticks = 0;
+
+		for( uint8 port = 0 ; port < DEBOUNCE_PORTS_NUM ; port++ )
+		{
+			state = DEBOUNCE_State[ port ];
+
+			/* Loop on the Pressed Inputs Only */
+			for( uint8 input = DEBOUNCE_INPUT( port , 0 ) ; state != 0 ; input++ , state >>= 1 )
+			{
+				if( ( state & 1 ) && ( DEBOUNCE_HoldSteps[ input ] < DEBOUNCE_LONG_PRESS_STEPS ) )
+				{
+					/* Queue the Long Press Event Once when the Hold Time is Reached */
+					if( ++DEBOUNCE_HoldSteps[ input ] == DEBOUNCE_LONG_PRESS_STEPS )
+					{
+						DEBOUNCE_QueuePush( DEBOUNCE_EVENT_LONG_PRESS | input );
+					}
+				}
+			}
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Gets the oldest event from the event queue.
+ *
+ * @return (uint8) The event, or DEBOUNCE_NO_EVENT if the queue is empty.
+ *                 Use DEBOUNCE_EVENT_TYPE( event ) and DEBOUNCE_EVENT_INPUT( event ) to read it.
+ *
+ * @example
+ * uint8 event = DEBOUNCE_GetEvent();
+ * if( event == ( DEBOUNCE_EVENT_PRESS | DEBOUNCE_INPUT( DIO_PORTD , DIO_PIN2 ) ) ) { ... }
+ */
+uint8 DEBOUNCE_GetEvent( void )
+{
+
+	uint8 event = DEBOUNCE_NO_EVENT;
+
+	/* Check if the Queue is not Empty */
+	if( DEBOUNCE_QueueTail != DEBOUNCE_QueueHead )
+	{
+		event = DEBOUNCE_Queue[ DEBOUNCE_QueueTail ];
+		DEBOUNCE_QueueTail = ( DEBOUNCE_QueueTail + 1 ) & ( DEBOUNCE_QUEUE_SIZE - 1 );
+	}
+
+	return event;
+}
+
+
+
+
+
+/*
+ * @brief Checks the debounced state of an input.
+ *
+ * @param input: Input number DEBOUNCE_INPUT( port , pin ).
+ *
+ * @return (uint8) true if the input is pressed, false otherwise.
+ */
+uint8 DEBOUNCE_IsPressed( uint8 input )
+{
+
+	/* Check if the Input Number is Valid */
+	if( input < DEBOUNCE_INPUTS_NUM )
+	{
+		return GET_BIT( DEBOUNCE_State[ input >> 3 ] , input & 7 );
+	}
+
+	return false;
+}
@@ -0,0 +1,84 @@
+/****************************************************************************
+ * @file    DEBOUNCE.h
+ * @author  Boles Medhat
+ * @brief   Input Debouncer Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a debouncer for up to 32 buttons or switches on any pins of
+ * DIO_PORTA to DIO_PORTD, sampled from a timer interrupt every 1, 2, 5 or 10 ms.
+ *
+ * The debouncer includes the following functionalities:
+ * - Debouncing all the pins of a port in parallel with vertical counters.
+ * - Press, release and long press events in an event queue.
+ * - Reading the debounced state of an input.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: With DEBOUNCE_TIMER0 or DEBOUNCE_TIMER2 you must initialize the timer
+ * 				   in CTC mode with the compare match interrupt enabled **before** calling
+ *	 	 	 	   DEBOUNCE_Init(). This driver does not initialize the timer internally.
+ * - With DEBOUNCE_TIMER_MANUAL call DEBOUNCE_Tick() every DEBOUNCE_TICK_MS from your own timer interrupt.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+#include <util/delay.h>
+#include "../../MCAL/DIO/DIO.h"
+#include "DEBOUNCE_config.h"
+
+
+/*
+ * @brief Initializes the debounced pins and starts sampling them.
+ *
+ * This function sets the debounced pins as inputs (with the internal pull-ups for
+ * DEBOUNCE_ACTIVE_LOW), takes their current levels as the debounced state so no
+ * event is generated for the inputs already pressed, and sets the timer callback.
+ */
+void DEBOUNCE_Init( void );
+
+
+/*
+ * @brief Samples all the debounced pins and queues their events.
+ *
+ * This function is called every DEBOUNCE_TICK_MS by the timer compare match interrupt.
+ * With DEBOUNCE_TIMER_MANUAL call it from your own periodic interrupt instead.
+ *
+ * Each port is debounced in parallel with two vertical counter bytes: a pin changes its
+ * debounced state after 4 equal samples that differ from it.
+ */
+void DEBOUNCE_Tick( void );
+
+
+/*
+ * @brief Gets the oldest event from the event queue.
+ *
+ * @return (uint8) The event, or DEBOUNCE_NO_EVENT if the queue is empty.
+ *                 Use DEBOUNCE_EVENT_TYPE( event ) and DEBOUNCE_EVENT_INPUT( event ) to read it.
+ *
+ * @example
+ * uint8 event = DEBOUNCE_GetEvent();
+ * if( event == ( DEBOUNCE_EVENT_PRESS | DEBOUNCE_INPUT( DIO_PORTD , DIO_PIN2 ) ) ) { ... }
+ */
+uint8 DEBOUNCE_GetEvent( void );
+
+
+/*
+ * @brief Checks the debounced state of an input.
+ *
+ * @param input: Input number DEBOUNCE_INPUT( port , pin ).
+ *
+ * @return (uint8) true if the input is pressed, false otherwise.
+ */
+uint8 DEBOUNCE_IsPressed( uint8 input );
+
+
+#endif /* DEBOUNCE_H_ */
@@ -0,0 +1,166 @@
+/****************************************************************************
+ * @file    DEBOUNCE_config.h
+ * @author  Boles Medhat
+ * @brief   Input Debouncer Configuration Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains configuration options for the input debouncer.
+ * It selects the debounced pins of each port, their active level, the sampling timer and period,
+ * the long press time and the size of the event queue.
+ *
+ * @note
+ * - All available choices are defined in `DEBOUNCE_def.h` and explained with comments there.
+ * - ⚠️ IMPORTANT: With DEBOUNCE_TIMER0 or DEBOUNCE_TIMER2 you must initialize the timer
+ * 				   in CTC mode with the compare match interrupt enabled **before** calling
+ *	 	 	 	   DEBOUNCE_Init(). This driver does not initialize the timer internally.
+ * - With DEBOUNCE_TIMER_MANUAL call DEBOUNCE_Tick() every DEBOUNCE_TICK_MS from your own timer interrupt.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef DEBOUNCE_CONFIG_H_
+#define DEBOUNCE_CONFIG_H_
+
+#include "DEBOUNCE_def.h"
+
+
+/*Set the Debounced Pins of each Port (bit n set for pin n, 0x00 if the port has no inputs)
+ * The pins of one port are debounced together in one byte operation
+ */
+#define DEBOUNCE_PORTA_PINS					0x00
+#define DEBOUNCE_PORTB_PINS					0x00
+#define DEBOUNCE_PORTC_PINS					0x00
+#define DEBOUNCE_PORTD_PINS					0x0F
+
+
+/*Set the Active Level of the Inputs
+ * choose between:
+ * 1. DEBOUNCE_ACTIVE_LOW					<--the most used (the internal pull-ups are enabled)
+ * 2. DEBOUNCE_ACTIVE_HIGH
+ */
+#define DEBOUNCE_ACTIVE_LEVEL				DEBOUNCE_ACTIVE_LOW
+
+
+/*Set the Timer that Samples the Inputs
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled
+ * choose between:
+ * 1. DEBOUNCE_TIMER_MANUAL					(call DEBOUNCE_Tick() from your own periodic interrupt)
+ * 2. DEBOUNCE_TIMER0
+ * 3. DEBOUNCE_TIMER2						<--the most used
+ */
+#define DEBOUNCE_TIMER						DEBOUNCE_TIMER2
+
+
+/*Set the Period of the Sampling Interrupt in ms
+ * An input changes after 4 equal samples, the period must divide the 10 ms hold step
+ * choose between:
+ * 1. 1
+ * 2. 2										<--the most used
+ * 3. 5
+ * 4. 10
+ */
+#define DEBOUNCE_TICK_MS					2
+
+
+/*Set the Time an Input is Held Pressed before the Long Press Event in ms (valid range: 100 - 2500)
+ * Counted in steps of 10 ms
+ */
+#define DEBOUNCE_LONG_PRESS_MS				1000	//<--the most used 1000
+
+
+/*Set the Number of Events in the Event Queue (new events are lost when it is full)
+ * choose between:
+ * 1. 8
+ * 2. 16									<--the most used
+ * 3. 32
+ */
+#define DEBOUNCE_QUEUE_SIZE					16
+
+
+
+/* Error checking for invalid configurations */
+#if ( DEBOUNCE_ACTIVE_LEVEL != DEBOUNCE_ACTIVE_LOW ) && ( DEBOUNCE_ACTIVE_LEVEL != DEBOUNCE_ACTIVE_HIGH )
+	#error "Wrong \"DEBOUNCE_ACTIVE_LEVEL\" configuration option"
+#endif
+
+#if ( DEBOUNCE_TICK_MS != 1 ) && ( DEBOUNCE_TICK_MS != 2 ) && ( DEBOUNCE_TICK_MS != 5 ) && ( DEBOUNCE_TICK_MS != 10 )
+	#error "Wrong \"DEBOUNCE_TICK_MS\" configuration option"
+#endif
+
+#if ( DEBOUNCE_LONG_PRESS_MS < 100 ) || ( DEBOUNCE_LONG_PRESS_MS > 2500 )
+	#error "the DEBOUNCE_LONG_PRESS_MS value not in range"
+#endif
+
+#if ( DEBOUNCE_QUEUE_SIZE != 8 ) && ( DEBOUNCE_QUEUE_SIZE != 16 ) && ( DEBOUNCE_QUEUE_SIZE != 32 )
+	#error "Wrong \"DEBOUNCE_QUEUE_SIZE\" configuration option"
+#endif
+
+/*Number of ticks in one hold step and number of hold steps to the long press*/
+#define DEBOUNCE_HOLD_STEP_TICKS			( DEBOUNCE_HOLD_STEP_MS / DEBOUNCE_TICK_MS )
+#define DEBOUNCE_LONG_PRESS_STEPS			( DEBOUNCE_LONG_PRESS_MS / DEBOUNCE_HOLD_STEP_MS )
+
+#if   DEBOUNCE_TIMER == DEBOUNCE_TIMER0
+
+	#include "../../MCAL/TIMER0/TIMER0.h"
+
+	/* You must initialize Timer0 manually "TIMER0_Init()" before using this driver */
+	#ifndef TIMER0_IN_HAL
+	#define TIMER0_IN_HAL
+		#warning "⚠️ Initialize Timer0 manually before using the debouncer."
+	#endif
+
+	/* Only one driver can use the Timer0 compare match */
+	#ifdef TIMER0_COMP_CLAIMED
+		#error "The Timer0 compare match is used by another driver, change DEBOUNCE_TIMER"
+	#endif
+	#define TIMER0_COMP_CLAIMED
+
+	/* Configure Timer0 to CTC mode */
+	#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+		#warning "⚠️ Configure Timer0 in CTC mode."
+	#endif
+
+	/* Enable Timer0 compare match interrupt */
+	#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer0 compare match interrupt."
+	#endif
+
+#elif DEBOUNCE_TIMER == DEBOUNCE_TIMER2
+
+	#include "../../MCAL/TIMER2/TIMER2.h"
+
+	/* You must initialize Timer2 manually "TIMER2_Init()" before using this driver */
+	#ifndef TIMER2_IN_HAL
+	#define TIMER2_IN_HAL
+		#warning "⚠️ Initialize Timer2 manually before using the debouncer."
+	#endif
+
+	/* Only one driver can use the Timer2 compare match */
+	#ifdef TIMER2_COMP_CLAIMED
+		#error "The Timer2 compare match is used by another driver, change DEBOUNCE_TIMER"
+	#endif
+	#define TIMER2_COMP_CLAIMED
+
+	/* Configure Timer2 to CTC mode */
+	#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+		#warning "⚠️ Configure Timer2 in CTC mode."
+	#endif
+
+	/* Enable Timer2 compare match interrupt */
+	#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer2 compare match interrupt."
+	#endif
+
+#elif DEBOUNCE_TIMER != DEBOUNCE_TIMER_MANUAL
+	#error "Wrong \"DEBOUNCE_TIMER\" configuration option"
+#endif
+
+
+#endif /* DEBOUNCE_CONFIG_H_ */
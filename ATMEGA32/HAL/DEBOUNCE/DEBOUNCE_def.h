@@ -0,0 +1,68 @@
+/****************************************************************************
+ * @file    DEBOUNCE_def.h
+ * @author  Boles Medhat
+ * @brief   Input Debouncer Definitions Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the input debouncer.
+ * An event is one byte that holds the event type and the input number
+ * (input number = port * 8 + pin, from 0 to 31).
+ *
+ * @note
+ * - These definitions are used in `DEBOUNCE_config.h` and `DEBOUNCE.c`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef DEBOUNCE_DEF_H_
+#define DEBOUNCE_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Input Active Levels*/
+#define DEBOUNCE_ACTIVE_LOW					0		/*The input is pressed when the pin is LOW  (button to GND with the internal pull-up)*/
+#define DEBOUNCE_ACTIVE_HIGH				1		/*The input is pressed when the pin is HIGH (button to VCC with an external pull-down)*/
+
+/*Timers that Sample the Inputs*/
+#define DEBOUNCE_TIMER_MANUAL				0		/*DEBOUNCE_Tick() is called by the user from any periodic interrupt*/
+#define DEBOUNCE_TIMER0						1		/*Timer0 compare match interrupt calls DEBOUNCE_Tick()*/
+#define DEBOUNCE_TIMER2						2		/*Timer2 compare match interrupt calls DEBOUNCE_Tick()*/
+
+/*Event Types*/
+#define DEBOUNCE_NO_EVENT					0x00	/*The event queue is empty*/
+#define DEBOUNCE_EVENT_PRESS				0x20	/*The input became pressed (after debouncing)*/
+#define DEBOUNCE_EVENT_RELEASE				0x40	/*The input became released (after debouncing)*/
+#define DEBOUNCE_EVENT_LONG_PRESS			0x60	/*The input is held pressed for DEBOUNCE_LONG_PRESS_MS*/
+
+/*Long Press Counting Step*/
+#define DEBOUNCE_HOLD_STEP_MS				10		/*Hold time is counted in steps of 10 ms*/
+
+/*Number of Inputs*/
+#define DEBOUNCE_PORTS_NUM					4		/*Inputs can be on DIO_PORTA to DIO_PORTD*/
+#define DEBOUNCE_INPUTS_NUM					32		/*8 inputs per port*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   macros    ----------------------------------------*/
+
+/*Input Number from the Port and Pin*/
+#define DEBOUNCE_INPUT( PORT , PIN )		( ( ( PORT ) << 3 ) | ( PIN ) )
+
+/*Event Fields*/
+#define DEBOUNCE_EVENT_TYPE( EVENT )		( ( EVENT ) & 0x60 )	/*DEBOUNCE_EVENT_PRESS, DEBOUNCE_EVENT_RELEASE or DEBOUNCE_EVENT_LONG_PRESS*/
+#define DEBOUNCE_EVENT_INPUT( EVENT )		( ( EVENT ) & 0x1F )	/*Input number (port * 8 + pin)*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* DEBOUNCE_DEF_H_ */
@@ -31,6 +31,40 @@
 
 
 
+#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+/*
+ * @brief Reads the cached value of an axis channel scanned in the background.
+ *
+ * This function is not intended for direct use by the user. A channel that is not in
+ * ADC_SCAN_CHANNELS (or not converted yet) reads as the neutral position, so the joystick
+ * stays centered instead of reporting a full deflection.
+ *
+ * @param channel: The ADC channel of the axis.
+ * @param neutral: The neutral (centered) value of the axis.
+ *
+ * @return: The 10-bit axis value.
+ */
+static uint16 JOYSTICK_ReadScannedChannel( uint8 channel , uint16 neutral )
+{
+
+	uint16 value = ADC_SCAN_GetValue( channel );
+
+	/* Check if the Channel has a Scanned Value */
+	if( value == ADC_SCAN_NO_VALUE )
+	{
+		value = neutral;
+	}
+
+	return value;
+}
+
+#endif
+
+
+
+
+
 /*
  * @brief Initializes the joystick by configuring the ADC and button.
  *
@@ -59,7 +93,7 @@ sint16 JOYSTICK_Read_X_Axis( void )
 {
 
 	/* Read the Raw ADC Value for the X-axis */
-	uint16 Raw_X_Value = ADC_Read_10_Bits( JOYSTICK_X_AXIS_CHANNEL );
+	uint16 Raw_X_Value = JOYSTICK_READ_CHANNEL( JOYSTICK_X_AXIS_CHANNEL , JOYSTICK_X_NEUTRAL );
 
 	/* Check if the X Value is Outside the Dead Zone */
 	if		( Raw_X_Value >= JOYSTICK_X_NEUTRAL + JOYSTICK_DEAD_ZONE )
@@ -96,7 +130,7 @@ sint16 JOYSTICK_Read_Y_Axis( void )
 {
 
 	/* Read the Raw ADC Value for the Y-axis */
-	uint16 Raw_Y_Value = ADC_Read_10_Bits( JOYSTICK_Y_AXIS_CHANNEL );
+	uint16 Raw_Y_Value = JOYSTICK_READ_CHANNEL( JOYSTICK_Y_AXIS_CHANNEL , JOYSTICK_Y_NEUTRAL );
 
 	/* Check if the Y Value is Outside the Dead Zone */
 	if		( Raw_Y_Value >= JOYSTICK_Y_NEUTRAL + JOYSTICK_DEAD_ZONE )
@@ -155,8 +189,8 @@ uint8 JOYSTICK_GetDirection( void )
 {
 
 	/* Read the Raw ADC Values for the X and Y Axes */
-	uint16 Raw_X_Value = ADC_Read_10_Bits( JOYSTICK_X_AXIS_CHANNEL );
-	uint16 Raw_Y_Value = ADC_Read_10_Bits( JOYSTICK_Y_AXIS_CHANNEL );
+	uint16 Raw_X_Value = JOYSTICK_READ_CHANNEL( JOYSTICK_X_AXIS_CHANNEL , JOYSTICK_X_NEUTRAL );
+	uint16 Raw_Y_Value = JOYSTICK_READ_CHANNEL( JOYSTICK_Y_AXIS_CHANNEL , JOYSTICK_Y_NEUTRAL );
 
 
 	/* Determine the Direction based on the X-axis Value */
@@ -115,9 +115,23 @@
 #endif
 
 
-/* Enable ADC overflow interrupt */
-#if ADC_INT_STATUS != ADC_INT_DISABLE
-	#warning "⚠️ Disable ADC interrupt."
+/* Read the Cached Value when the ADC Scans the Axes Channels in the Background (ADC_ISR_SCAN)
+ * JOYSTICK_X_AXIS_CHANNEL and JOYSTICK_Y_AXIS_CHANNEL must be in ADC_SCAN_CHANNELS and ADC_SCAN_Start()
+ * must be called first, an axis without a scanned value reads as its neutral position (centered)
+ */
+#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+	#define JOYSTICK_READ_CHANNEL( channel , neutral )	JOYSTICK_ReadScannedChannel( channel , neutral )
+
+#else
+
+	#define JOYSTICK_READ_CHANNEL( channel , neutral )	ADC_Read_10_Bits( channel )
+
+	/* Enable ADC overflow interrupt */
+	#if ADC_INT_STATUS != ADC_INT_DISABLE
+		#warning "⚠️ Disable ADC interrupt."
+	#endif
+
 #endif
 
 
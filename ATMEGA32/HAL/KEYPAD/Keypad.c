@@ -30,6 +30,151 @@ static const uint8 KEYPAD_ButtonsMap[KEYPAD_ROWS_NUM][KEYPAD_COLS_NUM] = KEYPAD_
 #endif
 
 
+#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+/* Debounced Keys of each Row (bit n set for a pressed key in column n) */
+volatile uint8 KEYPAD_State[ KEYPAD_ROWS_NUM ];
+
+
+/* Vertical Counters of each Row (bit n of both bytes is the 2-bit counter of the key in column n) */
+uint8 KEYPAD_Counter0[ KEYPAD_ROWS_NUM ];
+uint8 KEYPAD_Counter1[ KEYPAD_ROWS_NUM ];
+
+
+/* Event Queue (written by the Interrupt, read by the Application), each entry is the event type ORed with the key index */
+uint8 KEYPAD_Queue[ KEYPAD_QUEUE_SIZE ];
+volatile uint8 KEYPAD_QueueHead = 0;
+volatile uint8 KEYPAD_QueueTail = 0;
+
+
+/* Status of the Scan (true from the first press until all the keys are released) */
+volatile uint8 KEYPAD_Scanning = false;
+
+#endif
+
+
+
+
+
+/*
+ * @brief Converts the row and column of a key to the value returned to the user.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param row: Row of the key.
+ * @param col: Column of the key.
+ *
+ * @return The key as defined in the button map or its index, depending on `KEYPAD_RETURN_MODE`.
+ */
+static uint8 KEYPAD_KeyValue( uint8 row , uint8 col )
+{
+
+	/* Check on the Return mode Depending on the Configuration */
+	#if   KEYPAD_RETURN_MODE == KEYPAD_RETURN_CHAR
+
+		/* Return the Pressed Key as a Character from the Buttons Map Array */
+		return KEYPAD_ButtonsMap[row][col];
+
+	#elif KEYPAD_RETURN_MODE == KEYPAD_RETURN_INDEX
+
+		/* Return the Pressed Key as a calculated Index of the Pressed Key */
+		return row * KEYPAD_COLS_NUM + col;
+
+	#else
+		/* Make an Error */
+		#error "Wrong \"KEYPAD_RETURN_MODE\" configuration option"
+	#endif
+}
+
+
+
+
+
+#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+/*
+ * @brief Adds a key event to the event queue.
+ *
+ * This function is not intended for direct use by the user. It is called from the
+ * scan interrupt, the event is lost if the queue is full.
+ *
+ * @param event: The event type ORed with the key index.
+ */
+static void KEYPAD_QueuePush( uint8 event )
+{
+
+	/* Get the Next Head Position */
+	uint8 next_head = ( KEYPAD_QueueHead + 1 ) & ( KEYPAD_QUEUE_SIZE - 1 );
+
+	/* Check if the Queue is not Full */
+	if( next_head != KEYPAD_QueueTail )
+	{
+		KEYPAD_Queue[ KEYPAD_QueueHead ] = event;
+		KEYPAD_QueueHead = next_head;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Reads the pressed keys of one row.
+ *
+ * This function is not intended for direct use by the user. It drives the row LOW and
+ * releases the other rows (input without pull-up), so two keys pressed in the same column
+ * never connect a HIGH row to a LOW row.
+ *
+ * @param row: Row to read.
+ *
+ * @return (uint8) The pressed columns of the row (bit n set for column n).
+ */
+static uint8 KEYPAD_ReadRow( uint8 row )
+{
+
+	/* Drive Only this Row (its Port Bit is Kept LOW) */
+	DIO_DDR_REG( KEYPAD_ROW_PORT ) = ( DIO_DDR_REG( KEYPAD_ROW_PORT ) & ~KEYPAD_ROWS_MASK ) | ( 1 << ( KEYPAD_FIRST_ROW_PIN + row ) );
+
+	/* Wait for the Columns to Settle */
+	_delay_us( 2 );
+
+	/* Read All the Columns at Once (a Pressed Key Reads LOW) */
+	return ( ~DIO_PIN_REG( KEYPAD_COL_PORT ) & KEYPAD_COLS_MASK ) >> KEYPAD_FIRST_COL_PIN;
+}
+
+
+
+
+
+#if KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_SAMPLING
+
+/*
+ * @brief External interrupt handler that starts the scan on the first press.
+ *
+ * This function is not intended for direct use by the user. It is called by the external
+ * interrupt when a press pulls the columns LOW, and turns the scan timer interrupt on.
+ */
+static void KEYPAD_WakeInterrupt( void )
+{
+
+	/* Turn the External Interrupt Off while Scanning */
+	EXTI_DisableInterrupt( KEYPAD_WAKE_EXTI_ID );
+
+	/* Turn the Scan Timer Interrupt On */
+	#if   KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER0
+		TIMER0_InterruptEnable( TIMER0_COMP_ID );
+	#elif KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER2
+		TIMER2_InterruptEnable( TIMER2_COMP_ID );
+	#endif
+
+	KEYPAD_Scanning = true;
+}
+
+#endif
+
+#endif
+
+
 
 
 
@@ -37,30 +182,82 @@ static const uint8 KEYPAD_ButtonsMap[KEYPAD_ROWS_NUM][KEYPAD_COLS_NUM] = KEYPAD_
  * @brief Initializes the keypad by configuring row and column pins.
  *
  * This function sets up the keypad rows and columns:
- * - The row pins are configured as outputs and set to high.
+ * - The row pins are configured as outputs and set to high (KEYPAD_SCAN_POLLING),
+ *   or set to low so any press pulls a column low (KEYPAD_SCAN_INTERRUPT).
  * - The column pins are configured as inputs with internal pull-up resistors enabled.
+ *
+ * With KEYPAD_SCAN_INTERRUPT it also sets the timer (and external interrupt) callbacks.
  */
 void KEYPAD_Init( void )
 {
 
-	/* Loop on Keypad Row Pins to Initialize each Row Pin */
-	/* From First Pin (KEYPAD_FIRST_ROW_PIN) to Last Pin (KEYPAD_FIRST_ROW_PIN + KEYPAD_ROWS_NUM - 1)*/
-	for(uint8 row_num = 0 ; row_num < KEYPAD_ROWS_NUM ; row_num++)
-	{
-		/* Initialize the Keypad Row Pin Direction as Output */
-		DIO_SetPinDirection( KEYPAD_ROW_PORT , KEYPAD_FIRST_ROW_PIN + row_num , OUTPUT );
+	#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_POLLING
 
-		/* Set the Keypad Row Pin as High */
-		DIO_SetPinValue( KEYPAD_ROW_PORT , KEYPAD_FIRST_ROW_PIN + row_num , HIGH );
-	}
+		/* Loop on Keypad Row Pins to Initialize each Row Pin */
+		/* From First Pin (KEYPAD_FIRST_ROW_PIN) to Last Pin (KEYPAD_FIRST_ROW_PIN + KEYPAD_ROWS_NUM - 1)*/
+		for(uint8 row_num = 0 ; row_num < KEYPAD_ROWS_NUM ; row_num++)
+		{
+			/* Initialize the Keypad Row Pin Direction as Output */
+			DIO_SetPinDirection( KEYPAD_ROW_PORT , KEYPAD_FIRST_ROW_PIN + row_num , OUTPUT );
 
-	/* Loop on Keypad column Pins to Initialize each column Pin */
-	/* From First Pin (KEYPAD_FIRST_COL_PIN) to Last Pin (KEYPAD_FIRST_COL_PIN + KEYPAD_COLS_NUM - 1)*/
-	for(uint8 col_num = 0 ; col_num < KEYPAD_COLS_NUM ; col_num++)
-	{
-		/* Initialize the Keypad column Pin Direction as Input with Internal Pull-up Resistors */
-		DIO_SetPinDirection( KEYPAD_COL_PORT , KEYPAD_FIRST_COL_PIN + col_num , INPUT_PULLUP );
-	}
+			/* Set the Keypad Row Pin as High */
+			DIO_SetPinValue( KEYPAD_ROW_PORT , KEYPAD_FIRST_ROW_PIN + row_num , HIGH );
+		}
+
+		/* Loop on Keypad column Pins to Initialize each column Pin */
+		/* From First Pin (KEYPAD_FIRST_COL_PIN) to Last Pin (KEYPAD_FIRST_COL_PIN + KEYPAD_COLS_NUM - 1)*/
+		for(uint8 col_num = 0 ; col_num < KEYPAD_COLS_NUM ; col_num++)
+		{
+			/* Initialize the Keypad column Pin Direction as Input with Internal Pull-up Resistors */
+			DIO_SetPinDirection( KEYPAD_COL_PORT , KEYPAD_FIRST_COL_PIN + col_num , INPUT_PULLUP );
+		}
+
+	#elif KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+		DIO_PinGroup rows = { KEYPAD_ROW_PORT , KEYPAD_ROWS_MASK };
+		DIO_PinGroup cols = { KEYPAD_COL_PORT , KEYPAD_COLS_MASK };
+
+		/* Drive All the Rows LOW, so any Press Pulls its Column LOW */
+		DIO_WritePinGroup( &rows , LOW_PORT );
+		DIO_SetPinGroupDirection( &rows , OUTPUT );
+
+		/* Initialize the Columns as Input with Internal Pull-up Resistors */
+		DIO_SetPinGroupDirection( &cols , INPUT_PULLUP );
+
+		/* Reset the Debounced Keys and the Vertical Counters */
+		for( uint8 row = 0 ; row < KEYPAD_ROWS_NUM ; row++ )
+		{
+			KEYPAD_State[ row ] = 0;
+			KEYPAD_Counter0[ row ] = 0xFF;
+			KEYPAD_Counter1[ row ] = 0xFF;
+		}
+
+		/* Set the Timer Compare Match Interrupt Callback to Scan the Keypad */
+		#if   KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER0
+			TIMER0_SetCallback( TIMER0_COMP_ID , & KEYPAD_Tick );
+		#elif KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER2
+			TIMER2_SetCallback( TIMER2_COMP_ID , & KEYPAD_Tick );
+		#endif
+
+		#if KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_SAMPLING
+
+			/* Keep the Scan Timer Interrupt Off until the First Press */
+			#if   KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER0
+				TIMER0_InterruptDisable( TIMER0_COMP_ID );
+			#elif KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER2
+				TIMER2_InterruptDisable( TIMER2_COMP_ID );
+			#endif
+
+			/* Set the External Interrupt Callback to Detect the First Press */
+			EXTI_SetCallback( KEYPAD_WAKE_EXTI_ID , & KEYPAD_WakeInterrupt );
+
+			/* Clear any Edge Latched before Enabling (Writing 1 Clears the Flag) */
+			GIFR = ( 1 << KEYPAD_WAKE_INTF );
+			EXTI_EnableInterrupt( KEYPAD_WAKE_EXTI_ID );
+
+		#endif
+
+	#endif
 }
 
 
@@ -71,6 +268,7 @@ void KEYPAD_Init( void )
  * @brief Detects and returns the key that is currently pressed on the keypad.
  *
  * This function checks each row and column of the keypad to determine if a key is pressed.
+ * With KEYPAD_SCAN_INTERRUPT it returns the first key of the debounced state without scanning.
  * It returns the corresponding key based on the configuration:
  * - Returns a character based on the button map if `KEYPAD_RETURN_MODE` is set to `KEYPAD_RETURN_CHAR`.
  * - Returns an index value of the key in the keypad matrix if `KEYPAD_RETURN_MODE` is set to `KEYPAD_RETURN_INDEX`.
@@ -86,6 +284,23 @@ uint8 KEYPAD_GetPressedKey( void )
 	/* Variables to Iterate Over Rows and Columns */
 	uint8 row,col;
 
+	#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+		/* Loop through the Debounced Keys of each Row */
+		for(row = 0 ; row < KEYPAD_ROWS_NUM ; row++)
+		{
+			for(col = 0 ; col < KEYPAD_COLS_NUM ; col++)
+			{
+				if( GET_BIT( KEYPAD_State[ row ] , col ) )
+				{
+					/* Return the First Pressed Key */
+					return KEYPAD_KeyValue( row , col );
+				}
+			}
+		}
+
+	#else
+
 	/* Loop through each Row to Detect a Pressed Key */
 	for(row = 0 ; row < KEYPAD_ROWS_NUM ; row++)
 	{
@@ -101,21 +316,8 @@ uint8 KEYPAD_GetPressedKey( void )
 			/* Check if the Key in the Current Row and Column is Pressed (Column Pin Reads LOW) */
 			if(DIO_GetPinValue( KEYPAD_COL_PORT , KEYPAD_FIRST_COL_PIN + col ) == LOW)
 			{
-				/* Check on the Return mode Depending on the Configuration */
-				#if   KEYPAD_RETURN_MODE == KEYPAD_RETURN_CHAR
-
-					/* Return the Pressed Key as a Character from the Buttons Map Array */
-					Pressed_key = KEYPAD_ButtonsMap[row][col];
-
-				#elif KEYPAD_RETURN_MODE == KEYPAD_RETURN_INDEX
-
-					/* Return the Pressed Key as a calculated Index of the Pressed Key */
-					Pressed_key = row * KEYPAD_COLS_NUM + col;
-
-				#else
-					/* Make an Error */
-					#error "Wrong \"KEYPAD_RETURN_MODE\" configuration option"
-				#endif
+				/* Get the Pressed Key Depending on the Return Mode */
+				Pressed_key = KEYPAD_KeyValue( row , col );
 
 				/* Exit the Column Loop Since a Key has been Detected */
 				break;
@@ -134,9 +336,157 @@ uint8 KEYPAD_GetPressedKey( void )
 
 	}
 
+	#endif
+
 	/* Return the Pressed Key Value */
 	return Pressed_key;
 }
 
 
 
+
+
+#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+/*
+ * @brief Scans the keypad and queues the key events (KEYPAD_SCAN_INTERRUPT only).
+ *
+ * This function is called every KEYPAD_TICK_MS by the timer compare match interrupt.
+ * With KEYPAD_SCAN_TIMER_MANUAL call it from your own periodic interrupt instead.
+ *
+ * While the keypad is idle it does nothing (KEYPAD_WAKE_EXTIx) or reads the columns once
+ * (KEYPAD_WAKE_SAMPLING). After a press it scans all the rows each tick, debounces each key
+ * with vertical counters (a key changes after 4 equal scans) and queues a press or release
+ * event for each key that changes, so several keys can be held at the same time.
+ * It returns to idle when no key is pressed.
+ *
+ * @note More than 2 keys held at the same time need a diode on each key to avoid ghost keys.
+ */
+void KEYPAD_Tick( void )
+{
+
+	/* Keys Pressed or Changing in this Scan */
+	uint8 activity = 0;
+
+	uint8 changed;
+	uint8 counter0;
+	uint8 counter1;
+
+
+	/* Check if the Keypad is Idle */
+	if( KEYPAD_Scanning == false )
+	{
+		#if KEYPAD_WAKE_SOURCE == KEYPAD_WAKE_SAMPLING
+
+			/* All the Rows are LOW, so Read All the Columns Once to Detect a Press */
+			if( ( DIO_PIN_REG( KEYPAD_COL_PORT ) & KEYPAD_COLS_MASK ) == KEYPAD_COLS_MASK )
+			{
+				return;
+			}
+
+			KEYPAD_Scanning = true;
+
+		#else
+
+			/* The External Interrupt Starts the Scan */
+			return;
+
+		#endif
+	}
+
+
+	/* Loop on the Rows */
+	for( uint8 row = 0 ; row < KEYPAD_ROWS_NUM ; row++ )
+	{
+		uint8 sample = KEYPAD_ReadRow( row );
+
+		/* Get the Keys that Differ from the Debounced State */
+		changed = sample ^ KEYPAD_State[ row ];
+
+		/* Count Down the Counters of the Changed Keys, Reset the Others to their Start Value */
+		counter0 = ~( KEYPAD_Counter0[ row ] & changed );
+		counter1 = counter0 ^ ( KEYPAD_Counter1[ row ] & changed );
+		KEYPAD_Counter0[ row ] = counter0;
+		KEYPAD_Counter1[ row ] = counter1;
+
+		/* Keep the Keys that Changed for 4 Scans (their Counter Rolled Over) */
+		changed &= counter0 & counter1;
+
+		if( changed != 0 )
+		{
+			/* Toggle the Debounced State of the Keys */
+			KEYPAD_State[ row ] ^= changed;
+
+			/* Queue a Press or Release Event for each Changed Key */
+			for( uint8 col = 0 ; col < KEYPAD_COLS_NUM ; col++ )
+			{
+				if( GET_BIT( changed , col ) )
+				{
+					KEYPAD_QueuePush( ( GET_BIT( KEYPAD_State[ row ] , col ) ? KEYPAD_EVENT_PRESS : KEYPAD_EVENT_RELEASE ) | ( row * KEYPAD_COLS_NUM + col ) );
+				}
+			}
+		}
+
+		activity |= sample | KEYPAD_State[ row ];
+	}
+
+
+	/* Drive All the Rows LOW Again */
+	DIO_DDR_REG( KEYPAD_ROW_PORT ) |= KEYPAD_ROWS_MASK;
+
+
+	/* Return to Idle when No Key is Pressed */
+	if( activity == 0 )
+	{
+		KEYPAD_Scanning = false;
+
+		#if KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_SAMPLING
+
+			/* Turn the Scan Timer Interrupt Off and Wait for the Next Press */
+			#if   KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER0
+				TIMER0_InterruptDisable( TIMER0_COMP_ID );
+			#elif KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER2
+				TIMER2_InterruptDisable( TIMER2_COMP_ID );
+			#endif
+
+			/* Clear the Edges Latched while Scanning (Key Bounce) so They do not Wake the Keypad Again */
+			GIFR = ( 1 << KEYPAD_WAKE_INTF );
+			EXTI_EnableInterrupt( KEYPAD_WAKE_EXTI_ID );
+
+		#endif
+	}
+}
+
+
+
+
+
+/*
+ * @brief Gets the oldest key event from the event queue (KEYPAD_SCAN_INTERRUPT only).
+ *
+ * @param key: Pointer to store the key of the event, as defined in the button map or an index
+ *             depending on `KEYPAD_RETURN_MODE`.
+ *
+ * @return (uint8) KEYPAD_EVENT_PRESS, KEYPAD_EVENT_RELEASE, or KEYPAD_NO_EVENT if the queue is empty.
+ */
+uint8 KEYPAD_GetEvent( uint8 * key )
+{
+
+	uint8 event = KEYPAD_NO_EVENT;
+
+	/* Check if the Queue is not Empty */
+	if( KEYPAD_QueueTail != KEYPAD_QueueHead )
+	{
+		uint8 entry = KEYPAD_Queue[ KEYPAD_QueueTail ];
+		KEYPAD_QueueTail = ( KEYPAD_QueueTail + 1 ) & ( KEYPAD_QUEUE_SIZE - 1 );
+
+		/* Split the Entry to the Event Type and the Key */
+		event = entry & ( KEYPAD_EVENT_PRESS | KEYPAD_EVENT_RELEASE );
+		entry &= ~( KEYPAD_EVENT_PRESS | KEYPAD_EVENT_RELEASE );
+		*key = KEYPAD_KeyValue( entry / KEYPAD_COLS_NUM , entry % KEYPAD_COLS_NUM );
+	}
+
+	return event;
+}
+
+#endif
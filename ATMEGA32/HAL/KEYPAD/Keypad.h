@@ -14,6 +14,8 @@
  * The KEYPAD driver includes the following functionalities:
  * - Initialization of keypad row and column pins.
  * - Return of pressed key as character or index based on configuration.
+ * - Interrupt-driven scan with per-key debounce and a press/release event queue
+ *   for several keys held at the same time (KEYPAD_SCAN_INTERRUPT).
  *
  * @note
  * - Requires `KEYPAD_config.h` for macro-based configuration.
@@ -37,8 +39,11 @@
  * @brief Initializes the keypad by configuring row and column pins.
  *
  * This function sets up the keypad rows and columns:
- * - The row pins are configured as outputs and set to high.
+ * - The row pins are configured as outputs and set to high (KEYPAD_SCAN_POLLING),
+ *   or set to low so any press pulls a column low (KEYPAD_SCAN_INTERRUPT).
  * - The column pins are configured as inputs with internal pull-up resistors enabled.
+ *
+ * With KEYPAD_SCAN_INTERRUPT it also sets the timer (and external interrupt) callbacks.
  */
 void KEYPAD_Init( void );
 
@@ -47,6 +52,7 @@ void KEYPAD_Init( void );
  * @brief Detects and returns the key that is currently pressed on the keypad.
  *
  * This function checks each row and column of the keypad to determine if a key is pressed.
+ * With KEYPAD_SCAN_INTERRUPT it returns the first key of the debounced state without scanning.
  * It returns the corresponding key based on the configuration:
  * - Returns a character based on the button map if `KEYPAD_RETURN_MODE` is set to `KEYPAD_RETURN_CHAR`.
  * - Returns an index value of the key in the keypad matrix if `KEYPAD_RETURN_MODE` is set to `KEYPAD_RETURN_INDEX`.
@@ -56,4 +62,36 @@ void KEYPAD_Init( void );
 uint8 KEYPAD_GetPressedKey( void );
 
 
+#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+/*
+ * @brief Scans the keypad and queues the key events (KEYPAD_SCAN_INTERRUPT only).
+ *
+ * This function is called every KEYPAD_TICK_MS by the timer compare match interrupt.
+ * With KEYPAD_SCAN_TIMER_MANUAL call it from your own periodic interrupt instead.
+ *
+ * While the keypad is idle it does nothing (KEYPAD_WAKE_EXTIx) or reads the columns once
+ * (KEYPAD_WAKE_SAMPLING). After a press it scans all the rows each tick, debounces each key
+ * with vertical counters (a key changes after 4 equal scans) and queues a press or release
+ * event for each key that changes, so several keys can be held at the same time.
+ * It returns to idle when no key is pressed.
+ *
+ * @note More than 2 keys held at the same time need a diode on each key to avoid ghost keys.
+ */
+void KEYPAD_Tick( void );
+
+
+/*
+ * @brief Gets the oldest key event from the event queue (KEYPAD_SCAN_INTERRUPT only).
+ *
+ * @param key: Pointer to store the key of the event, as defined in the button map or an index
+ *             depending on `KEYPAD_RETURN_MODE`.
+ *
+ * @return (uint8) KEYPAD_EVENT_PRESS, KEYPAD_EVENT_RELEASE, or KEYPAD_NO_EVENT if the queue is empty.
+ */
+uint8 KEYPAD_GetEvent( uint8 * key );
+
+#endif
+
+
 #endif /* KEYPAD_H_ */
@@ -100,6 +100,51 @@
  {'*','0','#','D'}}
 
 
+/*Set the Keypad Scan Mode
+ * choose between:
+ * 1. KEYPAD_SCAN_POLLING					<--the default (KEYPAD_GetPressedKey scans the keypad)
+ * 2. KEYPAD_SCAN_INTERRUPT					(debounced press and release events of several keys, read by KEYPAD_GetEvent)
+ */
+#define KEYPAD_SCAN_MODE					KEYPAD_SCAN_POLLING
+
+
+/*Set the Timer that Paces the Scan (used only with KEYPAD_SCAN_INTERRUPT)
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled
+ * choose between:
+ * 1. KEYPAD_SCAN_TIMER_MANUAL				(call KEYPAD_Tick() from your own periodic interrupt)
+ * 2. KEYPAD_SCAN_TIMER0
+ * 3. KEYPAD_SCAN_TIMER2					<--the most used
+ */
+#define KEYPAD_SCAN_TIMER					KEYPAD_SCAN_TIMER2
+
+
+/*Set the Source that Detects the First Press of an Idle Keypad (used only with KEYPAD_SCAN_INTERRUPT)
+ * While the keypad is idle all the rows are driven LOW, so any press pulls a column LOW
+ * choose between:
+ * 1. KEYPAD_WAKE_SAMPLING					<--the most used (no extra hardware)
+ * 2. KEYPAD_WAKE_EXTI0						(columns to INT0 through diodes, lets the MCU sleep, needs KEYPAD_SCAN_TIMER0 or 2)
+ * 3. KEYPAD_WAKE_EXTI1						(columns to INT1 through diodes, lets the MCU sleep, needs KEYPAD_SCAN_TIMER0 or 2)
+ * 4. KEYPAD_WAKE_EXTI2						(columns to INT2 through diodes, lets the MCU sleep, needs KEYPAD_SCAN_TIMER0 or 2)
+ */
+#define KEYPAD_WAKE_SOURCE					KEYPAD_WAKE_SAMPLING
+
+
+/*Set the Period of the Scan Interrupt in ms (valid range: 2 - 10, used only with KEYPAD_SCAN_INTERRUPT)
+ * A key changes after 4 equal scans, so the debounce time is 4 periods
+ */
+#define KEYPAD_TICK_MS						5		//<--the most used 5
+
+
+/*Set the Number of Events in the Event Queue (used only with KEYPAD_SCAN_INTERRUPT)
+ * choose between:
+ * 1. 8
+ * 2. 16									<--the most used
+ * 3. 32
+ */
+#define KEYPAD_QUEUE_SIZE					16
+
+
+
 /*Error if config is invalid (out of range 1-8 or zero)*/
 #if   (KEYPAD_ROWS_NUM + KEYPAD_FIRST_ROW_PIN > 8) || (KEYPAD_ROWS_NUM == 0)
 	#error "KEYPAD_ROWS_NUM + KEYPAD_FIRST_ROW_PIN must be between 1 and 8"
@@ -107,5 +152,111 @@
 	#error "KEYPAD_COLS_NUM + KEYPAD_FIRST_COL_PIN must be between 1 and 8"
 #endif
 
+/*Pins of the Rows and the Columns*/
+#define KEYPAD_ROWS_MASK					( ( ( 1 << KEYPAD_ROWS_NUM ) - 1 ) << KEYPAD_FIRST_ROW_PIN )
+#define KEYPAD_COLS_MASK					( ( ( 1 << KEYPAD_COLS_NUM ) - 1 ) << KEYPAD_FIRST_COL_PIN )
+
+#if KEYPAD_SCAN_MODE == KEYPAD_SCAN_INTERRUPT
+
+	#if ( KEYPAD_TICK_MS < 2 ) || ( KEYPAD_TICK_MS > 10 )
+		#error "the KEYPAD_TICK_MS value not in range"
+	#endif
+
+	#if ( KEYPAD_QUEUE_SIZE != 8 ) && ( KEYPAD_QUEUE_SIZE != 16 ) && ( KEYPAD_QUEUE_SIZE != 32 )
+		#error "Wrong \"KEYPAD_QUEUE_SIZE\" configuration option"
+	#endif
+
+	#if   KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER0
+
+		#include "../../MCAL/TIMER0/TIMER0.h"
+
+		/* You must initialize Timer0 manually "TIMER0_Init()" before using this driver */
+		#ifndef TIMER0_IN_HAL
+		#define TIMER0_IN_HAL
+			#warning "⚠️ Initialize Timer0 manually before using the keypad scan."
+		#endif
+
+		/* Only one driver can use the Timer0 compare match */
+		#ifdef TIMER0_COMP_CLAIMED
+			#error "The Timer0 compare match is used by another driver, change KEYPAD_SCAN_TIMER"
+		#endif
+		#define TIMER0_COMP_CLAIMED
+
+		/* Configure Timer0 to CTC mode */
+		#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+			#warning "⚠️ Configure Timer0 in CTC mode."
+		#endif
+
+		/* Enable Timer0 compare match interrupt */
+		#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer0 compare match interrupt."
+		#endif
+
+	#elif KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER2
+
+		#include "../../MCAL/TIMER2/TIMER2.h"
+
+		/* You must initialize Timer2 manually "TIMER2_Init()" before using this driver */
+		#ifndef TIMER2_IN_HAL
+		#define TIMER2_IN_HAL
+			#warning "⚠️ Initialize Timer2 manually before using the keypad scan."
+		#endif
+
+		/* Only one driver can use the Timer2 compare match */
+		#ifdef TIMER2_COMP_CLAIMED
+			#error "The Timer2 compare match is used by another driver, change KEYPAD_SCAN_TIMER"
+		#endif
+		#define TIMER2_COMP_CLAIMED
+
+		/* Configure Timer2 to CTC mode */
+		#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+			#warning "⚠️ Configure Timer2 in CTC mode."
+		#endif
+
+		/* Enable Timer2 compare match interrupt */
+		#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer2 compare match interrupt."
+		#endif
+
+	#elif KEYPAD_SCAN_TIMER != KEYPAD_SCAN_TIMER_MANUAL
+		#error "Wrong \"KEYPAD_SCAN_TIMER\" configuration option"
+	#endif
+
+	#if KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_SAMPLING
+
+		#if ( KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_EXTI0 ) && ( KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_EXTI1 ) && ( KEYPAD_WAKE_SOURCE != KEYPAD_WAKE_EXTI2 )
+			#error "Wrong \"KEYPAD_WAKE_SOURCE\" configuration option"
+		#endif
+
+		#if KEYPAD_SCAN_TIMER == KEYPAD_SCAN_TIMER_MANUAL
+			#error "KEYPAD_WAKE_EXTIx needs KEYPAD_SCAN_TIMER0 or KEYPAD_SCAN_TIMER2 (the driver turns the timer interrupt off while idle)"
+		#endif
+
+		#include "../../MCAL/EXTI/EXTI.h"
+
+		/*External interrupt ID of the wake source*/
+		#define KEYPAD_WAKE_EXTI_ID			( KEYPAD_WAKE_SOURCE - KEYPAD_WAKE_EXTI0 )
+
+		/*Flag bit of the wake source in GIFR*/
+		#if   KEYPAD_WAKE_SOURCE == KEYPAD_WAKE_EXTI0
+			#define KEYPAD_WAKE_INTF			INTF0
+		#elif KEYPAD_WAKE_SOURCE == KEYPAD_WAKE_EXTI1
+			#define KEYPAD_WAKE_INTF			INTF1
+		#else
+			#define KEYPAD_WAKE_INTF			INTF2
+		#endif
+
+		/* You must initialize the External Interrupt manually "EXTI_Init()" (falling edge) before using this driver */
+		#ifndef EXTI_IN_HAL
+		#define EXTI_IN_HAL
+			#warning "⚠️ Initialize the External Interrupt manually (falling edge) before using the keypad wake source."
+		#endif
+
+	#endif
+
+#elif KEYPAD_SCAN_MODE != KEYPAD_SCAN_POLLING
+	#error "Wrong \"KEYPAD_SCAN_MODE\" configuration option"
+#endif
+
 
 #endif /* KEYPAD_CONFIG_H_ */
@@ -27,6 +27,31 @@
 /*Keypad Return Mode*/
 #define KEYPAD_RETURN_CHAR						0	/*Return the character representing the button pressed    (For example: '1', '2', ..., '#')*/
 #define KEYPAD_RETURN_INDEX						1	/*Return the button index representing the button pressed (For example: 0, 1, ..., 15)*/
+
+/*Keypad Scan Mode*/
+#define KEYPAD_SCAN_POLLING						0	/*KEYPAD_GetPressedKey() scans all the rows on each call*/
+#define KEYPAD_SCAN_INTERRUPT					1	/*A timer interrupt scans the keypad while a key is pressed and queues the key events*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Timers that Pace the Scan (KEYPAD_SCAN_INTERRUPT)*/
+#define KEYPAD_SCAN_TIMER_MANUAL				0	/*KEYPAD_Tick() is called by the user from any periodic interrupt*/
+#define KEYPAD_SCAN_TIMER0						1	/*Timer0 compare match interrupt calls KEYPAD_Tick()*/
+#define KEYPAD_SCAN_TIMER2						2	/*Timer2 compare match interrupt calls KEYPAD_Tick()*/
+
+/*Sources that Detect the First Press of an Idle Keypad (KEYPAD_SCAN_INTERRUPT)*/
+#define KEYPAD_WAKE_SAMPLING					0	/*Each tick reads the columns once while the keypad is idle*/
+#define KEYPAD_WAKE_EXTI0						1	/*The columns are ANDed (diodes) to INT0, the timer interrupt is off while the keypad is idle*/
+#define KEYPAD_WAKE_EXTI1						2	/*The columns are ANDed (diodes) to INT1, the timer interrupt is off while the keypad is idle*/
+#define KEYPAD_WAKE_EXTI2						3	/*The columns are ANDed (diodes) to INT2, the timer interrupt is off while the keypad is idle*/
+
+/*Key Events*/
+#define KEYPAD_NO_EVENT							0x00	/*The event queue is empty*/
+#define KEYPAD_EVENT_PRESS						0x40	/*The key became pressed (after debouncing)*/
+#define KEYPAD_EVENT_RELEASE					0x80	/*The key became released (after debouncing)*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -8,7 +8,7 @@
  *
  * @details
  * This driver provides a complete abstraction for interfacing with character
- * LCD modules (16x2 or 16x4) based on the HD44780 controller. It supports both
+ * LCD modules (16x2, 16x4, 20x2 or 20x4) based on the HD44780 controller. It supports both
  * 4-bit and 8-bit communication modes, initialization, and includes cursor tracking,
  * automatic row shifting, and custom character handling.
  *
@@ -25,10 +25,383 @@
 
 #include "LCD.h"
 
-/* Stores the Current Cursor Position on the LCD (Row: 0 to LCD_NUMBER_OF_ROWS, Col: 0 to 15) */
+/* Stores the Current Cursor Position on the LCD (Row: 0 to LCD_NUMBER_OF_ROWS, Col: 0 to LCD_NUMBER_OF_COLS) */
 uint8 LCD_CurrentRow = 0 , LCD_CurrentCol = 0;
 
 
+#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
+/* Stores the Expander Backlight Bit, Added to each Expander Byte */
+uint8 LCD_Backlight = ( LCD_BACKLIGHT_STATUS == LCD_BACKLIGHT_ON ) ? ( 1 << LCD_PCF8574_BACKLIGHT_BIT ) : 0;
+
+#endif
+
+
+#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+/* Stores a Copy of the Characters Shown on the LCD (Shadow of the DDRAM) */
+char LCD_Shadow[ LCD_NUMBER_OF_ROWS ][ LCD_NUMBER_OF_COLS ];
+
+#endif
+
+
+#if LCD_GLYPH_CACHE_MODE == LCD_GLYPH_CACHE_ENABLE
+
+/* Stores the Glyph Table in Program Memory (8 Bytes per Glyph) */
+static const uint8 * LCD_GlyphTable = NULL;
+
+/* Stores the Glyph ID Held by each CGRAM Slot (LCD_GLYPH_EMPTY if None) */
+static uint8 LCD_GlyphSlots[ LCD_CGRAM_SLOTS ];
+
+/* Stores the CGRAM Slots Ordered from the Most Recently Used to the Least Recently Used */
+static uint8 LCD_GlyphOrder[ LCD_CGRAM_SLOTS ];
+
+#endif
+
+
+#if LCD_GRAPHICS_MODE == LCD_GRAPHICS_ENABLE
+
+/* Stores the Segments of the Big Digits 0 to 9, Minus and Blank (Bit 0 to 6 for Segments a to g) */
+static const uint8 LCD_BigDigitSegments[ 12 ] = { 0x3F , 0x06 , 0x5B , 0x4F , 0x66 , 0x6D , 0x7D , 0x07 , 0x7F , 0x6F , 0x40 , 0x00 };
+
+#endif
+
+
+#if ( LCD_INTERFACE == LCD_INTERFACE_DIO ) && ( LCD_MODE == LCD_4_BITS_MODE ) && ( LCD_DATA_PINS_ORDER == LCD_DATA_PINS_MAPPED )
+
+/* Stores the Data Port Bits of each Nibble Value (Precomputed Map of the Non-Contiguous Data Pins) */
+static const uint8 LCD_NibblePins[ 16 ] =
+{
+	LCD_NIBBLE_PINS( 0x0 ) , LCD_NIBBLE_PINS( 0x1 ) , LCD_NIBBLE_PINS( 0x2 ) , LCD_NIBBLE_PINS( 0x3 ) ,
+	LCD_NIBBLE_PINS( 0x4 ) , LCD_NIBBLE_PINS( 0x5 ) , LCD_NIBBLE_PINS( 0x6 ) , LCD_NIBBLE_PINS( 0x7 ) ,
+	LCD_NIBBLE_PINS( 0x8 ) , LCD_NIBBLE_PINS( 0x9 ) , LCD_NIBBLE_PINS( 0xA ) , LCD_NIBBLE_PINS( 0xB ) ,
+	LCD_NIBBLE_PINS( 0xC ) , LCD_NIBBLE_PINS( 0xD ) , LCD_NIBBLE_PINS( 0xE ) , LCD_NIBBLE_PINS( 0xF )
+};
+
+#endif
+
+
+#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+/* Stores the Queued Bytes and their RS Pin Values (LOW for a Command, HIGH for Data) */
+uint8 LCD_QueueData[ LCD_QUEUE_SIZE ];
+uint8 LCD_QueueRS  [ LCD_QUEUE_SIZE ];
+
+/* Stores the Index of the Next Free Entry (Written by the Functions) and the Oldest Entry (Written by the Interrupt) */
+volatile uint8 LCD_QueueHead = 0 , LCD_QueueTail = 0;
+
+/* Stores the Number of Ticks to Wait Until the LCD Executes a Long Command */
+volatile uint8 LCD_QueueWaitTicks = 0;
+
+/* Stores whether the Initialization Finished and the Bytes are Queued (true) or Sent Directly (false) */
+uint8 LCD_QueueStatus = false;
+
+#endif
+
+
+
+
+
+#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+/*
+ * @brief Fills the shadow buffer with blanks, the same as the display after the clear screen command.
+ *
+ * This function is not intended for direct use by the user.
+ */
+static void LCD_ShadowClear( void )
+{
+	for( uint8 row = 0 ; row < LCD_NUMBER_OF_ROWS ; row++ )
+	{
+		for( uint8 col = 0 ; col < LCD_NUMBER_OF_COLS ; col++ )
+		{
+			LCD_Shadow[ row ][ col ] = LCD_BLANK_CHARACTER;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a character to a cell only if the shadow buffer shows that the cell changed.
+ *
+ * This function is not intended for direct use by the user. The LCD address counter moves to the
+ * next cell after each character, so the cursor command is sent only if the cell is not the one
+ * after the last written cell (the stored cursor position).
+ *
+ * @param row:       The row number (must be within the valid range).
+ * @param col:       The column number (must be within the valid range).
+ * @param character: The character to be displayed in the cell.
+ */
+static void LCD_WriteCell( uint8 row , uint8 col , char character )
+{
+
+	/* Skip the Cell if it Already Shows the Character */
+	if( LCD_Shadow[ row ][ col ] == character )
+	{
+		return;
+	}
+
+
+	/* Move the Cursor Only if the Cell is not the Next Cell after the Last Written One */
+	if( ( row != LCD_CurrentRow ) || ( col != LCD_CurrentCol ) )
+	{
+		LCD_SetCursor( row , col );
+	}
+
+
+	/* Send the Character Data to the LCD */
+	LCD_SendData( character );
+
+	/* Update the Shadow Buffer and the Stored Cursor Column */
+	LCD_Shadow[ row ][ col ] = character;
+	LCD_CurrentCol++;
+}
+
+#endif
+
+
+
+#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
+/*
+ * @brief Writes bytes to the PCF8574 expander pins in one I2C transfer.
+ *
+ * This function is not intended for direct use by the user. The expander outputs each
+ * received byte on its pins, so a burst of bytes makes the LCD pin changes in order.
+ *
+ * @param bytes: The expander pin values to be written in order.
+ * @param count: The number of bytes.
+ */
+static void LCD_ExpanderWrite( const uint8 * bytes , uint8 count )
+{
+
+	/* Send the Start Condition and the Expander Address with Write Operation */
+	if( ( I2C_Start() == SUCCESS ) && ( I2C_SendSlaveAddress_Write( LCD_PCF8574_ADDRESS ) == SUCCESS ) )
+	{
+		/* Send the Pin Values, Stop if the Expander does not Acknowledge */
+		for( uint8 index = 0 ; index < count ; index++ )
+		{
+			if( I2C_WriteData( bytes[ index ] ) == ERROR )
+			{
+				break;
+			}
+		}
+	}
+
+	/* Send the Stop Condition */
+	I2C_Stop();
+}
+
+#endif
+
+
+
+
+
+#if ( LCD_MODE == LCD_4_BITS_MODE ) && ( LCD_INTERFACE == LCD_INTERFACE_DIO )
+
+/*
+ * @brief Writes a nibble to the LCD data pins and pulses the enable pin.
+ *
+ * This function is not intended for direct use by the user. The data pins are written
+ * with one read-modify-write of the data port register: if the pins are contiguous the
+ * nibble is shifted to the first pin, otherwise the port bits are read from the
+ * precomputed pin map.
+ *
+ * @param nibble: The nibble to be written (0x00 to 0x0F).
+ */
+static void LCD_WriteNibble( uint8 nibble )
+{
+
+	#if LCD_DATA_PINS_ORDER == LCD_DATA_PINS_CONTIGUOUS
+
+		/* Write the 4 Data Pins at Once (the Pins are Contiguous) */
+		LCD_DATA_PORT_REG = ( LCD_DATA_PORT_REG & ~LCD_DATA_PINS_MASK ) | ( nibble << LCD_DATA_PIN0 );
+
+	#else
+
+		/* Write the 4 Data Pins at Once (Port Bits from the Pin Map) */
+		LCD_DATA_PORT_REG = ( LCD_DATA_PORT_REG & ~LCD_DATA_PINS_MASK ) | LCD_NibblePins[ nibble ];
+
+	#endif
+
+
+	/* Set Enable Pin to High to Signal the LCD that the Nibble is Ready to be Sent */
+	SET_BIT( LCD_E_PORT_REG , LCD_E_PIN );
+
+	/* Short Delay to Allow the LCD to Process the Received Nibble */
+	_delay_us( LCD_ENABLE_PULSE_DELAY );
+
+	/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that the Nibble is Sent */
+	CLR_BIT( LCD_E_PORT_REG , LCD_E_PIN );
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Writes a byte to the LCD pins and pulses the enable pin, without waiting for the LCD to execute it.
+ *
+ * This function is not intended for direct use by the user. In 4-bit mode the higher nibble
+ * is sent first, then the lower nibble. The pins are written directly in their port registers.
+ *
+ * @param rs_value: The RS pin value (LOW for a command, HIGH for data).
+ * @param byte:     The byte to be written.
+ */
+static void LCD_WriteByte( uint8 rs_value , uint8 byte )
+{
+
+	#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
+		/* The RS and Backlight Bits of the Expander Bytes */
+		uint8 control = LCD_Backlight | ( ( rs_value == LOW ) ? 0 : ( 1 << LCD_PCF8574_RS_BIT ) );
+
+		/* The Higher Nibble then the Lower Nibble, each Written with E High then with E Low (Falling Edge) */
+		uint8 expanderBytes[ 4 ];
+		expanderBytes[ 1 ] = control | LCD_PCF8574_NIBBLE( byte >> 4 );
+		expanderBytes[ 3 ] = control | LCD_PCF8574_NIBBLE( byte & 0x0F );
+		expanderBytes[ 0 ] = expanderBytes[ 1 ] | ( 1 << LCD_PCF8574_E_BIT );
+		expanderBytes[ 2 ] = expanderBytes[ 3 ] | ( 1 << LCD_PCF8574_E_BIT );
+
+		/* Send the 4 Expander Writes in One I2C Transfer (each I2C byte is longer than the enable pulse width) */
+		LCD_ExpanderWrite( expanderBytes , 4 );
+
+	#else
+
+		/* Set RS Pin to LOW for Command mode or HIGH for Data mode */
+		if( rs_value == LOW )
+		{
+			CLR_BIT( LCD_RS_PORT_REG , LCD_RS_PIN );
+		}
+		else
+		{
+			SET_BIT( LCD_RS_PORT_REG , LCD_RS_PIN );
+		}
+
+
+		/* Check the LCD mode */
+		#if   LCD_MODE == LCD_4_BITS_MODE
+			/* LCD 4 Bits Data mode */
+
+			/* Send the Higher Nibble (4 Bits) of the Byte */
+			LCD_WriteNibble( byte >> 4 );
+
+			/* Short Delay to Allow the LCD to Process the Received Nibble */
+			_delay_us( LCD_ENABLE_PULSE_DELAY );
+
+			/* Send the Lower Nibble (4 Bits) of the Byte */
+			LCD_WriteNibble( byte & 0x0F );
+
+
+		#elif LCD_MODE == LCD_8_BITS_MODE
+			/* LCD 8 Bits Data mode */
+
+			/* Send the Byte */
+			LCD_DATA_PORT_REG = byte;
+
+			/* Set Enable Pin to High to Signal the LCD that the Byte is Ready to be Sent */
+			SET_BIT( LCD_E_PORT_REG , LCD_E_PIN );
+
+			/* Short Delay to Allow the LCD to Process the Received Byte */
+			_delay_us( LCD_ENABLE_PULSE_DELAY );
+
+			/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that the Byte is Sent */
+			CLR_BIT( LCD_E_PORT_REG , LCD_E_PIN );
+
+		#endif
+
+	#endif
+
+}
+
+
+
+
+
+#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+/*
+ * @brief Stores a command or data byte at the head of the command queue.
+ *
+ * This function is not intended for direct use by the user. If the queue is full it waits
+ * until the timer interrupt sends the oldest entry.
+ *
+ * @param rs_value: The RS pin value (LOW for a command, HIGH for data).
+ * @param byte:     The byte to be sent to the LCD.
+ *
+ * @note The global interrupt must be enabled, or a full queue is never drained.
+ */
+static void LCD_QueuePush( uint8 rs_value , uint8 byte )
+{
+
+	/* Get the Index After the Head (the Size is a Power of 2) */
+	uint8 nextHead = ( LCD_QueueHead + 1 ) & ( LCD_QUEUE_SIZE - 1 );
+
+	/* Wait Until the Timer Interrupt Frees an Entry if the Queue is Full */
+	while( nextHead == LCD_QueueTail );
+
+	/* Store the Entry */
+	LCD_QueueRS  [ LCD_QueueHead ] = rs_value;
+	LCD_QueueData[ LCD_QueueHead ] = byte;
+
+	/* Publish the Entry to the Timer Interrupt */
+	LCD_QueueHead = nextHead;
+}
+
+
+
+
+
+/*
+ * @brief Sends one entry of the command queue to the LCD on each timer compare match.
+ *
+ * This function is called by the timer compare match interrupt every `LCD_QUEUE_TICK_US`,
+ * which covers the execution time of one byte. With LCD_QUEUE_TIMER_MANUAL call it from
+ * your own periodic interrupt instead. After a clear screen or return home command it
+ * skips the ticks needed for the long execution time.
+ *
+ * @note Other pins on the LCD ports should not be written by interrupts that can interrupt
+ *       this one or by code running with the interrupts enabled without care, since the DIO
+ *       functions read-modify-write the port registers.
+ */
+void LCD_QueueTick( void )
+{
+
+	/* Check if the LCD is Still Executing a Long Command */
+	if( LCD_QueueWaitTicks > 0 )
+	{
+		LCD_QueueWaitTicks--;
+	}
+
+	/* Check if the Queue has Entries */
+	else if( LCD_QueueTail != LCD_QueueHead )
+	{
+		uint8 rs_value = LCD_QueueRS  [ LCD_QueueTail ];
+		uint8 byte     = LCD_QueueData[ LCD_QueueTail ];
+
+		/* Write the Oldest Entry to the LCD Pins */
+		LCD_WriteByte( rs_value , byte );
+
+		/* The Clear Screen and Return Home Commands Need 1.64 ms to Execute */
+		if( ( rs_value == LOW ) && ( byte < LCD_CURSOR_SHIFT_LEFT ) )
+		{
+			LCD_QueueWaitTicks = LCD_QUEUE_LONG_WAIT_TICKS;
+		}
+
+		/* Free the Entry */
+		LCD_QueueTail = ( LCD_QueueTail + 1 ) & ( LCD_QUEUE_SIZE - 1 );
+	}
+}
+
+#endif
+
+
 
 
 
@@ -41,29 +414,48 @@ uint8 LCD_CurrentRow = 0 , LCD_CurrentCol = 0;
 void LCD_Init( void )
 {
 
-	/* Set the RS Pin Direction to OUTPUT */
-	DIO_SetPinDirection( LCD_RS_PORT , LCD_RS_PIN , OUTPUT );
+	#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
 
-	/* Set the E Pin Direction to OUTPUT */
-	DIO_SetPinDirection( LCD_E_PORT  , LCD_E_PIN  , OUTPUT );
+		/* Set All the Expander Pins to LOW Except the Backlight */
+		LCD_ExpanderWrite( & LCD_Backlight , 1 );
 
-	/* Check the LCD mode */
-	#if   LCD_MODE == LCD_4_BITS_MODE
+	#else
 
-		/*  Set the Direction of the Data Pins to OUTPUT for 4-bit mode */
-		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN0 , OUTPUT );
-		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN1 , OUTPUT );
-		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN2 , OUTPUT );
-		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN3 , OUTPUT );
+		/* Set the RS Pin Direction to OUTPUT */
+		DIO_SetPinDirection( LCD_RS_PORT , LCD_RS_PIN , OUTPUT );
 
-	#elif LCD_MODE == LCD_8_BITS_MODE
+		/* Set the E Pin Direction to OUTPUT */
+		DIO_SetPinDirection( LCD_E_PORT  , LCD_E_PIN  , OUTPUT );
 
-		/*  Set the Direction of the Data Port to OUTPUT for 8-bit mode */
-		DIO_SetPortDirection( LCD_DATA_PORT , OUTPUT_PORT );
 
-	#else
-		/* Make an Error */
-		#error "Wrong \"LCD_MODE\" configuration option"
+		#if LCD_RW_MODE == LCD_RW_CONNECTED
+
+			/* Set the R/W Pin Direction to OUTPUT and to LOW (Write) */
+			DIO_SetPinDirection( LCD_RW_PORT , LCD_RW_PIN , OUTPUT );
+			DIO_SetPinValue( LCD_RW_PORT , LCD_RW_PIN , LOW );
+
+		#endif
+
+
+		/* Check the LCD mode */
+		#if   LCD_MODE == LCD_4_BITS_MODE
+
+			/*  Set the Direction of the Data Pins to OUTPUT for 4-bit mode */
+			DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN0 , OUTPUT );
+			DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN1 , OUTPUT );
+			DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN2 , OUTPUT );
+			DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN3 , OUTPUT );
+
+		#elif LCD_MODE == LCD_8_BITS_MODE
+
+			/*  Set the Direction of the Data Port to OUTPUT for 8-bit mode */
+			DIO_SetPortDirection( LCD_DATA_PORT , OUTPUT_PORT );
+
+		#else
+			/* Make an Error */
+			#error "Wrong \"LCD_MODE\" configuration option"
+		#endif
+
 	#endif
 
 	/* Delay to Allow the LCD to Power up and Stabilize */
@@ -75,24 +467,718 @@ void LCD_Init( void )
 	/* Return Home */
 	LCD_SendCommand( LCD_RETURN_TO_HOME );
 
-	/* delay to Ensure the LCD Processes the Return Home Command*/
-	_delay_ms( 2 );
+	/* delay to Ensure the LCD Processes the Return Home Command*/
+	_delay_ms( 2 );
+
+	/* Set the Number of Data Bits mode (4-bit or 8-bit) */
+	LCD_SendCommand( LCD_MODE );
+
+	/* Configure the Cursor Display Status (On, Off, or Blinking) */
+	LCD_SendCommand( LCD_CURSOR_STATUS );
+
+	/* Set the Cursor Shift Direction (Left or Right) */
+	LCD_SendCommand( LCD_CURSOR_SHIFT_RIGHT );
+
+	/* Clear the LCD Screen */
+	LCD_SendCommand( LCD_CLEAR_SCREEN );
+
+	/* delay to Ensure the LCD Processes the Clear Screen Command*/
+	_delay_ms( 2 );
+
+
+	#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+		/* The Cleared Screen Shows Blanks in All the Cells */
+		LCD_ShadowClear();
+
+	#endif
+
+
+	#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+		/* Set the Queue Tick Period and the Timer Compare Match Interrupt Callback to Drain the Command Queue */
+		#if   LCD_QUEUE_TIMER == LCD_QUEUE_TIMER0
+			TIMER0_SetCompareValue( LCD_QUEUE_TIMER_TOP );
+			TIMER0_SetCallback( TIMER0_COMP_ID , & LCD_QueueTick );
+		#elif LCD_QUEUE_TIMER == LCD_QUEUE_TIMER2
+			TIMER2_SetCompareValue( LCD_QUEUE_TIMER_TOP );
+			TIMER2_SetCallback( TIMER2_COMP_ID , & LCD_QueueTick );
+		#endif
+
+		/* Queue the Next Commands and Data Instead of Waiting for the LCD */
+		LCD_QueueStatus = true;
+
+	#endif
+
+}
+
+
+
+
+
+/*
+ * @brief Prints a single character on the LCD at the current cursor position.
+ *
+ * This function sends the specified character to the LCD and updates the cursor
+ * position accordingly. It handles automatic row switching based on the defined
+ * `LCD_AUTO_MOVE_MODE` configuration, either disabling or enabling automatic row
+ * movement when the cursor exceeds the column limit of the first row.
+ *
+ * @param character: The character to be displayed on the LCD.
+ */
+void LCD_PrintCharacter( char character )
+{
+
+	#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+		/* Keep the Shadow Buffer Equal to the Display (Characters Past the Row End are not Mirrored) */
+		if( ( LCD_CurrentRow < LCD_NUMBER_OF_ROWS ) && ( LCD_CurrentCol < LCD_NUMBER_OF_COLS ) )
+		{
+			LCD_Shadow[ LCD_CurrentRow ][ LCD_CurrentCol ] = character;
+		}
+
+	#endif
+
+
+	/* Send the Character Data to the LCD */
+	LCD_SendData( character );
+
+	/* Update the Stored Cursor Column */
+	LCD_CurrentCol++;
+
+
+	#if LCD_AUTO_MOVE_MODE == LCD_AUTO_MOVE_ROW_ENABLE
+
+		/* Check if the Cursor is on the Row and has Reached or Passed the End (16 character) */
+		if ( LCD_CurrentRow < LCD_NUMBER_OF_ROWS && LCD_CurrentCol >=  LCD_NUMBER_OF_COLS )
+		{
+			/* Move to the Second Row */
+			LCD_SetCursor( LCD_CurrentRow + 1 , LCD_CurrentCol - LCD_NUMBER_OF_COLS );
+		}
+
+	#endif
+
+}
+
+
+
+
+
+/*
+ * @brief Prints a string on the LCD starting at the current cursor position.
+ *
+ * This function iterates through each character of the provided string and
+ * prints them one by one on the LCD.
+ *
+ * @param str: The string to be printed on the LCD. The string should be null-terminated.
+ */
+void LCD_PrintString( const char * str )
+{
+
+	/*  Loop through each Character of the String Until the NULL Character is found */
+	for(uint8 CharacterIndex = 0 ; str[CharacterIndex] != '\0' ; CharacterIndex++)
+	{
+		/* Print each Character on the LCD */
+		LCD_PrintCharacter( str[CharacterIndex] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Prints a signed integer number on the LCD at the current cursor position.
+ *
+ * This function converts the given integer number to a string in base 10
+ * and then prints it on the LCD starting at the current cursor position.
+ *
+ * @param number: The signed integer number to be printed on the LCD.
+ */
+void LCD_PrintNumber( sint32 number )
+{
+
+	/* Store the integer number to arr & 10 is for decimal numbering system*/
+	char str[12];
+	DC_itoa( number , str , 10 );
+
+	/* Print the String on the LCD */
+	LCD_PrintString( str );
+}
+
+
+
+
+
+/*
+ * @brief Sets the cursor to a specific row and column on the LCD.
+ *
+ * This function moves the cursor to the specified row and column on the LCD screen.
+ * The row can be range 0 to LCD_MAX_ROWS-1, and the column can range from 0 to 15.
+ * The cursor's position is updated globally to track the current position.
+ *
+ * @param row: The row number (0 to LCD_MAX_ROWS-1) to position the cursor on.
+ * @param col: The column number (0 to 15) to position the cursor at.
+ */
+void LCD_SetCursor( uint8 row , uint8 col )
+{
+
+	/* Check if the Specified Row and Column are Within the Valid Range */
+	if( ( row < LCD_NUMBER_OF_ROWS ) && ( col < LCD_NUMBER_OF_COLS ) )
+	{
+		/* Update the Global Variables to Track the Current Cursor Position */
+		LCD_CurrentRow = row;
+		LCD_CurrentCol = col;
+
+		/* Initialize the Position Command with the base Command for Setting DDRAM Address */
+		uint8 position = LCD_SET_DDRAM_ADDRESS;
+
+
+		/* First LCD Row */
+		if ( row == 0 )
+		{
+			/* Set Position for the First Row (Row 0) */
+			position |= LCD_FIRST_ROW_ADDRESS;
+		}
+		else if ( row == 1 )
+		{
+			/* Set Position for the Second Row (Row 1) */
+			position |= LCD_SECOND_ROW_ADDRESS;
+		}
+		else if ( row == 2 )
+		{
+			/* Set Position for the third Row (Row 2) */
+			position |= LCD_THIRD_ROW_ADDRESS;
+		}
+		else
+		{
+			/* Set Position for the fourth Row (Row 3) */
+			position |= LCD_FOURTH_ROW_ADDRESS;
+		}
+
+		/* Adding the Column Offset */
+		position += col;
+
+		/* Send the Command to the LCD to Set the Cursor to the Calculated Position */
+		LCD_SendCommand( position );
+	}
+}
+
+
+
+
+/*
+ * @brief Clears the entire LCD screen and sets the cursor to the home position (0,0).
+ *
+ * This function clears the LCD display and resets the cursor position to the top-left corner
+ * (row 0, column 0).
+ */
+void LCD_ClearScreen( void )
+{
+
+	/* Clear the LCD Screen and Sets the Cursor to the Home Position (0,0) */
+	LCD_SendCommand( LCD_CLEAR_SCREEN );
+
+	/* Update the Global Variables to Cursor to the Home Position (0,0) */
+	LCD_CurrentRow = 0;
+	LCD_CurrentCol = 0;
+
+
+	#if ( LCD_RW_MODE == LCD_RW_GROUNDED ) && ( LCD_QUEUE_MODE == LCD_QUEUE_DISABLE )
+
+		/* delay to Ensure the LCD Processes the Clear Screen Command (with the R/W pin or the queue the next command waits for the LCD) */
+		_delay_ms(2);
+
+	#endif
+
+
+	#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+		/* The Cleared Screen Shows Blanks in All the Cells */
+		LCD_ShadowClear();
+
+	#endif
+}
+
+
+
+
+
+#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+/*
+ * @brief Writes a character to a cell of the LCD only if the cell shows a different character.
+ *
+ * The character is compared with the shadow buffer (the SRAM copy of the display contents).
+ * The cursor is moved only if the cell is not the next cell after the last written one.
+ *
+ * @param row:       The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:       The column number (0 to LCD_NUMBER_OF_COLS-1).
+ * @param character: The character to be displayed in the cell.
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteCharacter( uint8 row , uint8 col , char character )
+{
+
+	/* Check if the Specified Row and Column are Within the Valid Range */
+	if( ( row < LCD_NUMBER_OF_ROWS ) && ( col < LCD_NUMBER_OF_COLS ) )
+	{
+		/* Send the Character Only if it Changed */
+		LCD_WriteCell( row , col , character );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes a string to a row of the LCD, sending only the characters that changed.
+ *
+ * Each character is compared with the shadow buffer (the SRAM copy of the display contents),
+ * unchanged characters are skipped, and the cursor is moved only when the next changed
+ * character is not next to the last written one. The string is cut at the end of the row.
+ *
+ * @param row: The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col: The column number (0 to LCD_NUMBER_OF_COLS-1) of the first character.
+ * @param str: The string to be written. The string should be null-terminated.
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteString( uint8 row , uint8 col , const char * str )
+{
+
+	/* Check if the Specified Row is Within the Valid Range */
+	if( row < LCD_NUMBER_OF_ROWS )
+	{
+		/*  Loop through each Character of the String Until the NULL Character or the Row End */
+		for( ; ( *str != '\0' ) && ( col < LCD_NUMBER_OF_COLS ) ; str++ , col++ )
+		{
+			/* Send the Character Only if it Changed */
+			LCD_WriteCell( row , col , *str );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes a signed integer number to a field of the LCD, sending only the characters that changed.
+ *
+ * The number is written from the field start and the rest of the field is filled with blanks,
+ * so a shorter number clears the digits of the previous one.
+ *
+ * @param row:    The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:    The column number (0 to LCD_NUMBER_OF_COLS-1) of the field start.
+ * @param number: The signed integer number to be written.
+ * @param width:  The field width in characters (cut at the end of the row).
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteNumber( uint8 row , uint8 col , sint32 number , uint8 width )
+{
+
+	/* Store the integer number to arr & 10 is for decimal numbering system*/
+	char str[12];
+	DC_itoa( number , str , 10 );
+
+
+	/* Check if the Specified Row is Within the Valid Range */
+	if( row < LCD_NUMBER_OF_ROWS )
+	{
+		/* Loop through the Field Cells Until the Field or the Row Ends */
+		for( uint8 index = 0 , isEnded = false ; ( index < width ) && ( col < LCD_NUMBER_OF_COLS ) ; index++ , col++ )
+		{
+			/* Fill the Cells After the Number with Blanks (str is not Read After its End) */
+			if( ( isEnded == false ) && ( str[ index ] == '\0' ) )
+			{
+				isEnded = true;
+			}
+
+			/* Send the Character Only if it Changed */
+			LCD_WriteCell( row , col , ( isEnded == true ) ? LCD_BLANK_CHARACTER : str[ index ] );
+		}
+	}
+}
+
+#endif
+
+
+
+
+
+#if LCD_GLYPH_CACHE_MODE == LCD_GLYPH_CACHE_ENABLE
+
+/*
+ * @brief Checks if a character code is shown in any cell of the shadow buffer except one cell.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param code:     The character code (CGRAM slot) to search for.
+ * @param skip_row: The row of the cell to skip (LCD_NUMBER_OF_ROWS to skip no cell).
+ * @param skip_col: The column of the cell to skip.
+ *
+ * @return uint8 true if the code is shown, false otherwise.
+ */
+static uint8 LCD_GlyphIsShown( uint8 code , uint8 skip_row , uint8 skip_col )
+{
+	for( uint8 row = 0 ; row < LCD_NUMBER_OF_ROWS ; row++ )
+	{
+		for( uint8 col = 0 ; col < LCD_NUMBER_OF_COLS ; col++ )
+		{
+			/* Check the Cell if it is not the Skipped One */
+			if( ( LCD_Shadow[ row ][ col ] == code ) && ( ( row != skip_row ) || ( col != skip_col ) ) )
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+
+
+
+
+/*
+ * @brief Returns the CGRAM slot of a glyph, loading the glyph on a miss.
+ *
+ * This function is not intended for direct use by the user. The used slot is moved to the
+ * front of the LRU order. On a miss the slot is taken from the back of the order, skipping
+ * the slots shown on the screen (except in the skipped cell).
+ *
+ * @param glyph_id: The glyph index in the glyph table.
+ * @param skip_row: The row of the cell that will be overwritten (LCD_NUMBER_OF_ROWS for none).
+ * @param skip_col: The column of the cell that will be overwritten.
+ *
+ * @return uint8 The CGRAM slot (0 to 7), or LCD_GLYPH_NO_SLOT.
+ */
+static uint8 LCD_GlyphLoad( uint8 glyph_id , uint8 skip_row , uint8 skip_col )
+{
+
+	uint8 orderIndex;
+	uint8 slot = LCD_GLYPH_NO_SLOT;
+
+
+	/* Search for the Glyph in the CGRAM Slots */
+	for( orderIndex = 0 ; orderIndex < LCD_CGRAM_SLOTS ; orderIndex++ )
+	{
+		if( LCD_GlyphSlots[ LCD_GlyphOrder[ orderIndex ] ] == glyph_id )
+		{
+			slot = LCD_GlyphOrder[ orderIndex ];
+			break;
+		}
+	}
+
+
+	/* Check if the Glyph is not Loaded (Miss) */
+	if( slot == LCD_GLYPH_NO_SLOT )
+	{
+		/* Search for the Least Recently Used Slot that is not Shown on the Screen */
+		for( orderIndex = LCD_CGRAM_SLOTS ; orderIndex > 0 ; orderIndex-- )
+		{
+			if( LCD_GlyphIsShown( LCD_GlyphOrder[ orderIndex - 1 ] , skip_row , skip_col ) == false )
+			{
+				break;
+			}
+		}
+
+		/* Check if All the Slots are Shown on the Screen */
+		if( orderIndex == 0 )
+		{
+			return LCD_GLYPH_NO_SLOT;
+		}
+
+		orderIndex--;
+		slot = LCD_GlyphOrder[ orderIndex ];
+
+
+		/* Send the Command to Set the CGRAM Address of the Slot */
+		LCD_SendCommand( LCD_SET_CGRAM_ADDRESS | ( slot << 3 ) );
+
+		/* Write the 8 Bytes of the Glyph from the Program Memory */
+		for( uint8 byteIndex = 0 ; byteIndex < LCD_CHAR_SIZE ; byteIndex++ )
+		{
+			LCD_SendData( pgm_read_byte( & LCD_GlyphTable[ glyph_id * LCD_CHAR_SIZE + byteIndex ] ) );
+		}
+
+		/* Restore Cursor to the Previous Position (the Address Counter Points to the CGRAM) */
+		LCD_SetCursor( LCD_CurrentRow , LCD_CurrentCol );
+
+		LCD_GlyphSlots[ slot ] = glyph_id;
+	}
+
+
+	/* Move the Slot to the Front of the Order (Most Recently Used) */
+	for( ; orderIndex > 0 ; orderIndex-- )
+	{
+		LCD_GlyphOrder[ orderIndex ] = LCD_GlyphOrder[ orderIndex - 1 ];
+	}
+	LCD_GlyphOrder[ 0 ] = slot;
+
+
+	return slot;
+}
+
+
+
+
+
+/*
+ * @brief Sets the glyph table of the glyph cache and marks all the CGRAM slots empty.
+ *
+ * @param glyph_table: The glyphs in program memory, 8 row bytes per glyph (such as `const uint8 glyphs[][8] PROGMEM`).
+ *                     The glyph ID is the index in the table (0 to 254).
+ *
+ * @note Do not use `LCD_SaveCustomChar` while the glyph cache is used.
+ */
+void LCD_GlyphInit( const uint8 * glyph_table )
+{
+
+	/* Store the Glyph Table */
+	LCD_GlyphTable = glyph_table;
+
+	/* Mark All the Slots Empty */
+	for( uint8 slot = 0 ; slot < LCD_CGRAM_SLOTS ; slot++ )
+	{
+		LCD_GlyphSlots[ slot ] = LCD_GLYPH_EMPTY;
+		LCD_GlyphOrder[ slot ] = slot;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Returns the character code of a glyph, loading it to the CGRAM only if it is not there.
+ *
+ * A glyph already in a CGRAM slot is reused. Otherwise the least recently used glyph that is
+ * not shown on the screen is replaced, and the 8 bytes of the new glyph are written to its slot.
+ *
+ * @param glyph_id: The glyph index in the glyph table.
+ *
+ * @return uint8 The character code (0 to 7) to print, or LCD_GLYPH_NO_SLOT if all the
+ *               slots hold glyphs shown on the screen.
+ */
+uint8 LCD_GlyphGetCode( uint8 glyph_id )
+{
+	/* Load the Glyph if Needed, Keeping All the Glyphs on the Screen */
+	return LCD_GlyphLoad( glyph_id , LCD_NUMBER_OF_ROWS , 0 );
+}
+
+
+
+
+
+/*
+ * @brief Writes a glyph to a cell of the LCD, loading it to the CGRAM only if it is not there.
+ *
+ * The glyph shown in the cell itself may be replaced, so a cell can change its glyph even
+ * when all the other slots are on the screen. The cell is written only if it changed.
+ *
+ * @param row:      The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:      The column number (0 to LCD_NUMBER_OF_COLS-1).
+ * @param glyph_id: The glyph index in the glyph table.
+ *
+ * @return uint8 SUCCESS if the glyph is written, ERROR if the cell is out of range or
+ *               all the slots hold glyphs shown on the screen.
+ */
+uint8 LCD_WriteGlyph( uint8 row , uint8 col , uint8 glyph_id )
+{
+
+	/* Check if the Specified Row and Column are Within the Valid Range */
+	if( ( row >= LCD_NUMBER_OF_ROWS ) || ( col >= LCD_NUMBER_OF_COLS ) )
+	{
+		return ERROR;
+	}
+
+
+	/* Load the Glyph if Needed, the Glyph Shown in this Cell can be Replaced */
+	uint8 code = LCD_GlyphLoad( glyph_id , row , col );
+
+	/* Check if there is no Free Slot */
+	if( code == LCD_GLYPH_NO_SLOT )
+	{
+		return ERROR;
+	}
+
+
+	/* Send the Character Code Only if it Changed (a Reloaded Slot Updates the Cell by Itself) */
+	LCD_WriteCell( row , col , code );
+
+	return SUCCESS;
+}
+
+#endif
+
+
+
+
+
+#if LCD_GRAPHICS_MODE == LCD_GRAPHICS_ENABLE
+
+/*
+ * @brief Saves a custom character made of filled rows with the same filled columns.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param code:      The CGRAM address (0 to 7).
+ * @param rows_mask: The filled rows (bit 0 for the top row).
+ * @param cols_bits: The filled columns of each filled row (bit 4 for the left column).
+ */
+static void LCD_SaveBlockChar( uint8 code , uint8 rows_mask , uint8 cols_bits )
+{
+
+	uint8 customChar[ LCD_CHAR_SIZE ];
+
+	/* Fill the Rows of the Custom Character */
+	for( uint8 byteIndex = 0 ; byteIndex < LCD_CHAR_SIZE ; byteIndex++ )
+	{
+		customChar[ byteIndex ] = ( GET_BIT( rows_mask , byteIndex ) == 1 ) ? cols_bits : 0x00;
+	}
+
+	/* Save the Custom Character to the CGRAM */
+	LCD_SaveCustomChar( customChar , code );
+}
+
+
+
+
+
+/*
+ * @brief Writes a run of cells in one row.
+ *
+ * This function is not intended for direct use by the user. The run is cut at the end of
+ * the row. With the shadow buffer only the changed cells are sent, otherwise the cursor is
+ * set once and the cells are sent in order.
+ *
+ * @param row:   The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:   The column of the first cell.
+ * @param cells: The characters of the cells.
+ * @param count: The number of cells.
+ */
+static void LCD_WriteCells( uint8 row , uint8 col , const char * cells , uint8 count )
+{
+
+	/* Check if the Specified Row and Column are Within the Valid Range */
+	if( ( row >= LCD_NUMBER_OF_ROWS ) || ( col >= LCD_NUMBER_OF_COLS ) )
+	{
+		return;
+	}
+
+	/* Cut the Run at the End of the Row */
+	if( count > LCD_NUMBER_OF_COLS - col )
+	{
+		count = LCD_NUMBER_OF_COLS - col;
+	}
+
+
+	#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+		/* Send each Cell Only if it Changed */
+		for( uint8 index = 0 ; index < count ; index++ )
+		{
+			LCD_WriteCell( row , col + index , cells[ index ] );
+		}
+
+	#else
+
+		/* Set the Cursor Once, the LCD Moves it after each Character */
+		LCD_SetCursor( row , col );
+
+		for( uint8 index = 0 ; index < count ; index++ )
+		{
+			LCD_PrintCharacter( cells[ index ] );
+		}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Returns the character of a cell in a big digit.
+ *
+ * This function is not intended for direct use by the user. The left and right columns show
+ * full blocks for the vertical segments (f, b in the upper half and e, c in the lower half),
+ * the other cells show the horizontal segments: a at the top of the first row, g at the bottom
+ * of the middle row and d at the bottom of the last row.
+ *
+ * @param segments: The segments of the digit (bit 0 to 6 for segments a to g).
+ * @param height:   The digit height [ LCD_BIG_2_ROWS , LCD_BIG_4_ROWS ].
+ * @param row:      The row inside the digit.
+ * @param col:      The column inside the digit (0 to 2).
+ *
+ * @return char The character code of the cell.
+ */
+static char LCD_BigDigitCell( uint8 segments , uint8 height , uint8 row , uint8 col )
+{
+
+	/* Vertical Segments: f and b in the Upper Half, e and c in the Lower Half */
+	uint8 isUpperHalf = ( row < height / 2 );
+
+	if( ( col == 0 ) && ( GET_BIT( segments , ( isUpperHalf == true ) ? 5 : 4 ) == 1 ) )
+	{
+		return LCD_FULL_BLOCK;
+	}
+
+	if( ( col == LCD_BIG_DIGIT_WIDTH - 1 ) && ( GET_BIT( segments , ( isUpperHalf == true ) ? 1 : 2 ) == 1 ) )
+	{
+		return LCD_FULL_BLOCK;
+	}
+
+
+	/* Horizontal Segments: a at the Top of the Digit, g at the Middle, d at the Bottom */
+	uint8 isUpper = ( row == 0 ) && GET_BIT( segments , 0 );
+	uint8 isLower = ( ( row == height / 2 - 1 ) && GET_BIT( segments , 6 ) ) || ( ( row == height - 1 ) && GET_BIT( segments , 3 ) );
+
+	if( isUpper && isLower )
+	{
+		return LCD_BIG_BOTH_CODE;
+	}
+	else if( isUpper )
+	{
+		return LCD_BIG_UPPER_CODE;
+	}
+	else if( isLower )
+	{
+		return LCD_BIG_LOWER_CODE;
+	}
+	else
+	{
+		return LCD_BLANK_CHARACTER;
+	}
+}
+
 
-	/* Set the Number of Data Bits mode (4-bit or 8-bit) */
-	LCD_SendCommand( LCD_MODE );
 
-	/* Configure the Cursor Display Status (On, Off, or Blinking) */
-	LCD_SendCommand( LCD_CURSOR_STATUS );
 
-	/* Set the Cursor Shift Direction (Left or Right) */
-	LCD_SendCommand( LCD_CURSOR_SHIFT_RIGHT );
 
-	/* Clear the LCD Screen */
-	LCD_SendCommand( LCD_CLEAR_SCREEN );
+/*
+ * @brief Saves the big digit pieces and the bar graph cells to the CGRAM slots 0 to 6.
+ *
+ * This function must be called after `LCD_Init` and before the big digit and bar graph functions.
+ */
+void LCD_GraphicsInit( void )
+{
 
-	/* delay to Ensure the LCD Processes the Clear Screen Command*/
-	_delay_ms( 2 );
+	/* Save the Big Digit Pieces (Upper Bar, Lower Bar and Both Bars) */
+	LCD_SaveBlockChar( LCD_BIG_UPPER_CODE , 0x07 , 0x1F );
+	LCD_SaveBlockChar( LCD_BIG_LOWER_CODE , 0xE0 , 0x1F );
+	LCD_SaveBlockChar( LCD_BIG_BOTH_CODE  , 0xE7 , 0x1F );
 
+	/* Save the Bar Cells with 1 to 4 Filled Columns from the Left (5 Columns is the Full Block) */
+	for( uint8 columns = 1 ; columns < LCD_BAR_CELL_COLUMNS ; columns++ )
+	{
+		LCD_SaveBlockChar( LCD_BAR_FIRST_CODE + columns - 1 , 0xFF , ( 0x1F << ( LCD_BAR_CELL_COLUMNS - columns ) ) & 0x1F );
+	}
 }
 
 
@@ -100,36 +1186,44 @@ void LCD_Init( void )
 
 
 /*
- * @brief Prints a single character on the LCD at the current cursor position.
+ * @brief Writes a big digit of 3 columns x 2 or 4 rows composed of custom characters.
  *
- * This function sends the specified character to the LCD and updates the cursor
- * position accordingly. It handles automatic row switching based on the defined
- * `LCD_AUTO_MOVE_MODE` configuration, either disabling or enabling automatic row
- * movement when the cursor exceeds the column limit of the first row.
+ * The digit is built from its 7 segments: the vertical segments are full blocks and the
+ * horizontal segments are bar pieces. The column after the digit is written blank.
+ * With the shadow buffer enabled only the changed cells are sent.
  *
- * @param character: The character to be displayed on the LCD.
+ * @param row:    The top row of the digit.
+ * @param col:    The left column of the digit.
+ * @param digit:  The digit (0 to 9), LCD_BIG_MINUS or LCD_BIG_BLANK.
+ * @param height: The digit height [ LCD_BIG_2_ROWS , LCD_BIG_4_ROWS ].
+ *
+ * @note The cursor is left after the last written cell.
  */
-void LCD_PrintCharacter( char character )
+void LCD_WriteBigDigit( uint8 row , uint8 col , uint8 digit , uint8 height )
 {
 
-	/* Send the Character Data to the LCD */
-	LCD_SendData( character );
-
-	/* Update the Stored Cursor Column */
-	LCD_CurrentCol++;
+	/* Check if the Digit and Height are Valid and the Digit Fits in the Rows */
+	if( ( digit > LCD_BIG_BLANK ) || ( ( height != LCD_BIG_2_ROWS ) && ( height != LCD_BIG_4_ROWS ) ) || ( row + height > LCD_NUMBER_OF_ROWS ) )
+	{
+		return;
+	}
 
 
-	#if LCD_AUTO_MOVE_MODE == LCD_AUTO_MOVE_ROW_ENABLE
+	/* The Cells of One Digit Row and the Blank Column after it */
+	char cells[ LCD_BIG_DIGIT_WIDTH + 1 ];
+	cells[ LCD_BIG_DIGIT_WIDTH ] = LCD_BLANK_CHARACTER;
 
-		/* Check if the Cursor is on the Row and has Reached or Passed the End (16 character) */
-		if ( LCD_CurrentRow < LCD_NUMBER_OF_ROWS && LCD_CurrentCol >=  LCD_COLS_NUM )
+	for( uint8 digitRow = 0 ; digitRow < height ; digitRow++ )
+	{
+		/* Compose the Cells of the Row from the Digit Segments */
+		for( uint8 digitCol = 0 ; digitCol < LCD_BIG_DIGIT_WIDTH ; digitCol++ )
 		{
-			/* Move to the Second Row */
-			LCD_SetCursor( LCD_CurrentRow + 1 , LCD_CurrentCol - LCD_COLS_NUM );
+			cells[ digitCol ] = LCD_BigDigitCell( LCD_BigDigitSegments[ digit ] , height , digitRow , digitCol );
 		}
 
-	#endif
-
+		/* Write the Row of the Digit */
+		LCD_WriteCells( row + digitRow , col , cells , LCD_BIG_DIGIT_WIDTH + 1 );
+	}
 }
 
 
@@ -137,21 +1231,49 @@ void LCD_PrintCharacter( char character )
 
 
 /*
- * @brief Prints a string on the LCD starting at the current cursor position.
+ * @brief Writes a signed integer number with big digits to a field of the LCD.
  *
- * This function iterates through each character of the provided string and
- * prints them one by one on the LCD.
+ * Each digit takes 4 columns (3 for the digit and a blank one). The number is written from
+ * the field start and the rest of the field is filled with blank digits, so a shorter number
+ * clears the digits of the previous one.
  *
- * @param str: The string to be printed on the LCD. The string should be null-terminated.
+ * @param row:    The top row of the number.
+ * @param col:    The left column of the field.
+ * @param number: The signed integer number to be written.
+ * @param width:  The field width in digits (cut at the end of the row).
+ * @param height: The digit height [ LCD_BIG_2_ROWS , LCD_BIG_4_ROWS ].
+ *
+ * @note The cursor is left after the last written cell.
  */
-void LCD_PrintString( const char * str )
+void LCD_WriteBigNumber( uint8 row , uint8 col , sint32 number , uint8 width , uint8 height )
 {
 
-	/*  Loop through each Character of the String Until the NULL Character is found */
-	for(uint8 CharacterIndex = 0 ; str[CharacterIndex] != '\0' ; CharacterIndex++)
+	/* Store the integer number to arr & 10 is for decimal numbering system*/
+	char str[12];
+	DC_itoa( number , str , 10 );
+
+
+	/* Loop through the Field Digits Until the Field or the Row Ends */
+	for( uint8 index = 0 , isEnded = false ; ( index < width ) && ( col < LCD_NUMBER_OF_COLS ) ; index++ , col += LCD_BIG_DIGIT_WIDTH + 1 )
 	{
-		/* Print each Character on the LCD */
-		LCD_PrintCharacter( str[CharacterIndex] );
+		/* Fill the Digits After the Number with Blanks */
+		if( str[ index ] == '\0' )
+		{
+			isEnded = true;
+		}
+
+		if( isEnded == true )
+		{
+			LCD_WriteBigDigit( row , col , LCD_BIG_BLANK , height );
+		}
+		else if( str[ index ] == '-' )
+		{
+			LCD_WriteBigDigit( row , col , LCD_BIG_MINUS , height );
+		}
+		else
+		{
+			LCD_WriteBigDigit( row , col , str[ index ] - '0' , height );
+		}
 	}
 }
 
@@ -160,22 +1282,43 @@ void LCD_PrintString( const char * str )
 
 
 /*
- * @brief Prints a signed integer number on the LCD at the current cursor position.
- *
- * This function converts the given integer number to a string in base 10
- * and then prints it on the LCD starting at the current cursor position.
+ * @brief Initializes a horizontal bar graph and draws it empty.
  *
- * @param number: The signed integer number to be printed on the LCD.
+ * @param bar:   Pointer to the bar graph structure.
+ * @param row:   The row of the bar.
+ * @param col:   The left column of the bar.
+ * @param width: The number of cells of the bar (5 levels per cell, cut at the end of the row).
  */
-void LCD_PrintNumber( sint32 number )
+void LCD_BarInit( LCD_Bar * bar , uint8 row , uint8 col , uint8 width )
 {
 
-	/* Store the integer number to arr & 10 is for decimal numbering system*/
-	char str[12];
-	DC_itoa( number , str , 10 );
+	/* Cut the Bar at the End of the Row, so its Full Level is on the Screen (at most 20 x 5 Columns) */
+	if( col >= LCD_NUMBER_OF_COLS )
+	{
+		width = 0;
+	}
+	else if( width > ( LCD_NUMBER_OF_COLS - col ) )
+	{
+		width = LCD_NUMBER_OF_COLS - col;
+	}
 
-	/* Print the String on the LCD */
-	LCD_PrintString( str );
+
+	/* Store the Bar Position and Size */
+	bar->row   = row;
+	bar->col   = col;
+	bar->width = width;
+	bar->level = 0;
+
+
+	/* Draw the Empty Bar */
+	char cells[ LCD_NUMBER_OF_COLS ];
+
+	for( uint8 index = 0 ; index < LCD_NUMBER_OF_COLS ; index++ )
+	{
+		cells[ index ] = LCD_BLANK_CHARACTER;
+	}
+
+	LCD_WriteCells( row , col , cells , width );
 }
 
 
@@ -183,82 +1326,70 @@ void LCD_PrintNumber( sint32 number )
 
 
 /*
- * @brief Sets the cursor to a specific row and column on the LCD.
+ * @brief Sets the value of a bar graph, sending only the cells that changed.
  *
- * This function moves the cursor to the specified row and column on the LCD screen.
- * The row can be range 0 to LCD_MAX_ROWS-1, and the column can range from 0 to 15.
- * The cursor's position is updated globally to track the current position.
+ * The bar has 5 levels per cell. When the value moves inside a cell only that boundary cell
+ * is sent, otherwise the cells between the old and the new boundary are sent.
  *
- * @param row: The row number (0 to LCD_MAX_ROWS-1) to position the cursor on.
- * @param col: The column number (0 to 15) to position the cursor at.
+ * @param bar:     Pointer to the bar graph structure.
+ * @param percent: The bar value (0 to 100).
+ *
+ * @note The cursor is left after the last written cell.
  */
-void LCD_SetCursor( uint8 row , uint8 col )
+void LCD_BarSetValue( LCD_Bar * bar , uint8 percent )
 {
 
-	/* Check if the Specified Row and Column are Within the Valid Range */
-	if( ( row < LCD_NUMBER_OF_ROWS ) && ( col < LCD_COLS_NUM ) )
+	/* Limit the Value to 100% */
+	if( percent > 100 )
 	{
-		/* Update the Global Variables to Track the Current Cursor Position */
-		LCD_CurrentRow = row;
-		LCD_CurrentCol = col;
+		percent = 100;
+	}
 
-		/* Initialize the Position Command with the base Command for Setting DDRAM Address */
-		uint8 position = LCD_SET_DDRAM_ADDRESS;
+	/* Convert the Value to Filled Pixel Columns */
+	uint8 level = ( (uint16) percent * bar->width * LCD_BAR_CELL_COLUMNS ) / 100;
 
 
-		/* First LCD Row */
-		if ( row == 0 )
-		{
-			/* Set Position for the First Row (Row 0) */
-			position |= LCD_FIRST_ROW_ADDRESS;
-		}
-		else if ( row == 1 )
+	/* Check if the Bar Changed */
+	if( level == bar->level )
+	{
+		return;
+	}
+
+
+	/* Get the Cells Between the Old and the New Boundary */
+	uint8 firstCell = ( ( level < bar->level ) ? level : bar->level ) / LCD_BAR_CELL_COLUMNS;
+	uint8 lastCell  = ( ( ( level > bar->level ) ? level : bar->level ) - 1 ) / LCD_BAR_CELL_COLUMNS;
+
+	char cells[ LCD_NUMBER_OF_COLS ];
+	uint8 count = 0;
+
+	for( uint8 cell = firstCell ; ( cell <= lastCell ) && ( count < LCD_NUMBER_OF_COLS ) ; cell++ , count++ )
+	{
+		/* Filled Columns of this Cell */
+		sint16 columns = level - cell * LCD_BAR_CELL_COLUMNS;
+
+		if( columns <= 0 )
 		{
-			/* Set Position for the Second Row (Row 1) */
-			position |= LCD_SECOND_ROW_ADDRESS;
+			cells[ count ] = LCD_BLANK_CHARACTER;
 		}
-		else if ( row == 2 )
+		else if( columns >= LCD_BAR_CELL_COLUMNS )
 		{
-			/* Set Position for the third Row (Row 2) */
-			position |= LCD_THIRD_ROW_ADDRESS;
+			cells[ count ] = LCD_FULL_BLOCK;
 		}
 		else
 		{
-			/* Set Position for the fourth Row (Row 3) */
-			position |= LCD_FOURTH_ROW_ADDRESS;
+			cells[ count ] = LCD_BAR_FIRST_CODE + columns - 1;
 		}
-
-		/* Adding the Column Offset */
-		position += col;
-
-		/* Send the Command to the LCD to Set the Cursor to the Calculated Position */
-		LCD_SendCommand( position );
 	}
-}
-
-
-
-
-/*
- * @brief Clears the entire LCD screen and sets the cursor to the home position (0,0).
- *
- * This function clears the LCD display and resets the cursor position to the top-left corner
- * (row 0, column 0).
- */
-void LCD_ClearScreen( void )
-{
-
-	/* Clear the LCD Screen and Sets the Cursor to the Home Position (0,0) */
-	LCD_SendCommand( LCD_CLEAR_SCREEN );
 
-	/* Update the Global Variables to Cursor to the Home Position (0,0) */
-	LCD_CurrentRow = 0;
-	LCD_CurrentCol = 0;
+	/* Write the Changed Cells */
+	LCD_WriteCells( bar->row , bar->col + firstCell , cells , count );
 
-	/* delay to Ensure the LCD Processes the Clear Screen Command*/
-	_delay_ms(2);
+	bar->level = level;
 }
 
+#endif
+
 
 
 
@@ -373,10 +1504,10 @@ void LCD_ShiftDisplayRight( void )
 	#if LCD_AUTO_MOVE_MODE == LCD_AUTO_MOVE_ROW_ENABLE
 
 		/* Check if the Cursor is on the Row and has Reached or Passed the End (0x10) */
-		if ( LCD_CurrentRow < LCD_NUMBER_OF_ROWS && LCD_CurrentCol >=  LCD_COLS_NUM )
+		if ( LCD_CurrentRow < LCD_NUMBER_OF_ROWS && LCD_CurrentCol >=  LCD_NUMBER_OF_COLS )
 		{
 			/* Move to the Second Row */
-			LCD_SetCursor( LCD_CurrentRow + 1 , LCD_CurrentCol - LCD_COLS_NUM );
+			LCD_SetCursor( LCD_CurrentRow + 1 , LCD_CurrentCol - LCD_NUMBER_OF_COLS );
 		}
 
 	#endif
@@ -387,176 +1518,238 @@ void LCD_ShiftDisplayRight( void )
 
 
 
+#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
 /*
- * @brief Sends a command to the LCD to control its operation.
+ * @brief Turns the backlight of a PCF8574 backpack on or off.
  *
- * This function sends a command byte to the LCD. The command can either be in 4-bit or 8-bit mode,
- * depending on the LCD configuration. The function sets the appropriate pins for the command,
- * and includes necessary delays for the LCD to process the command.
+ * The backlight bit is kept in all the next expander writes.
  *
- * @param command: The command byte to be sent to the LCD.
+ * @param backlight_status: The backlight status [ LCD_BACKLIGHT_OFF , LCD_BACKLIGHT_ON ].
  */
-void LCD_SendCommand( uint8 command )
+void LCD_SetBacklight( uint8 backlight_status )
+{
+
+	/* Update the Backlight Bit */
+	LCD_Backlight = ( backlight_status == LCD_BACKLIGHT_ON ) ? ( 1 << LCD_PCF8574_BACKLIGHT_BIT ) : 0;
+
+	/* Write the Backlight Bit with the Other Pins LOW (E is LOW, so the LCD Ignores it) */
+	LCD_ExpanderWrite( & LCD_Backlight , 1 );
+}
+
+#endif
+
+
+
+
+
+#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+/*
+ * @brief Returns whether all the queued commands and data were sent to the LCD.
+ *
+ * The queue is empty when the timer interrupt has sent every entry and the LCD
+ * finished the last clear screen or return home command.
+ *
+ * @return uint8 true if the queue is empty, false if entries are still waiting.
+ */
+uint8 LCD_IsQueueEmpty( void )
+{
+	return ( LCD_QueueHead == LCD_QueueTail ) && ( LCD_QueueWaitTicks == 0 );
+}
+
+#endif
+
+
+
+
+
+#if LCD_RW_MODE == LCD_RW_CONNECTED
+
+/*
+ * @brief Waits until the LCD finishes the previous command or data.
+ *
+ * This function is not intended for direct use by the user. It sets the data pins to input,
+ * reads the busy flag (DB7) until it is cleared or `LCD_BUSY_TIMEOUT` reads are made,
+ * then sets the data pins back to output. In 4-bit mode the lower nibble is also read
+ * to complete each read operation.
+ */
+static void LCD_WaitUntilReady( void )
 {
-	/* Sends a Command to the LCD to Control its Operation */
 
 	/* Check the LCD mode */
 	#if   LCD_MODE == LCD_4_BITS_MODE
-		/* LCD 4 Bits Data mode */
-
-		/* Set RS Pin to LOW for Command mode */
-		DIO_SetPinValue( LCD_RS_PORT , LCD_RS_PIN , LOW );
 
+		/*  Set the Direction of the Data Pins to INPUT to Read the Busy Flag */
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN0 , INPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN1 , INPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN2 , INPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN3 , INPUT );
 
-		/* Send the Higher Nibble (4 Bits) of the Command */
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN0 , GET_BIT( command , 4 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN1 , GET_BIT( command , 5 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN2 , GET_BIT( command , 6 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN3 , GET_BIT( command , 7 ) );
+	#elif LCD_MODE == LCD_8_BITS_MODE
 
+		/*  Set the Direction of the Data Port to INPUT to Read the Busy Flag */
+		DIO_SetPortDirection( LCD_DATA_PORT , INPUT_PORT );
 
-		/* Set Enable Pin to High to Signal the LCD that Command is Ready to be Sent */
-		DIO_SetPinValue( LCD_E_PORT  , LCD_E_PIN  , HIGH );
+	#endif
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(10);
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Command is Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
+	/* Set RS Pin to LOW and R/W Pin to HIGH to Read the Busy Flag and Address */
+	DIO_SetPinValue( LCD_RS_PORT , LCD_RS_PIN , LOW );
+	DIO_SetPinValue( LCD_RW_PORT , LCD_RW_PIN , HIGH );
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(10);
 
-		/* Send the Lower Nibble (4 Bits) of the Command */
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN0 , GET_BIT( command , 0 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN1 , GET_BIT( command , 1 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN2 , GET_BIT( command , 2 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN3 , GET_BIT( command , 3 ) );
+	uint8 isBusy;
+	uint16 reads = 0;
 
-		/* Set Enable Pin to High to Signal the LCD that Command is Ready to be Sent */
+	do
+	{
+		/* Set Enable Pin to High, the LCD Outputs the Busy Flag on DB7 */
 		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , HIGH );
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(10);
+		/* Short Delay to Allow the LCD to Output the Busy Flag */
+		_delay_us( LCD_ENABLE_PULSE_DELAY );
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Command is Sent */
+		/* Read the Busy Flag */
+		#if   LCD_MODE == LCD_4_BITS_MODE
+			isBusy = DIO_GetPinValue( LCD_DATA_PORT , LCD_DATA_PIN3 );
+		#elif LCD_MODE == LCD_8_BITS_MODE
+			isBusy = DIO_GetPinValue( LCD_DATA_PORT , DIO_PIN7 );
+		#endif
+
+		/* Set Enable Pin to Low to End the Read */
 		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(60);
+		/* Short Delay Before the Next Enable Pulse */
+		_delay_us( LCD_ENABLE_PULSE_DELAY );
 
 
-	#elif LCD_MODE == LCD_8_BITS_MODE
-		/* LCD 8 Bits Data mode */
+		#if LCD_MODE == LCD_4_BITS_MODE
 
-		/* Set RS Pin to LOW for Command mode */
-		DIO_SetPinValue( LCD_RS_PORT , LCD_RS_PIN , LOW );
+			/* Read the Lower Nibble (Address Counter Bits) to Complete the 4-bit Read */
+			DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , HIGH );
+			_delay_us( LCD_ENABLE_PULSE_DELAY );
+			DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
+			_delay_us( LCD_ENABLE_PULSE_DELAY );
 
-		/* Send the Command */
-		DIO_SetPortValue( LCD_DATA_PORT , command );
+		#endif
 
-		/* Set Enable Pin to High to Signal the LCD that Command is Ready to be Sent */
-		DIO_SetPinValue( LCD_E_PORT  , LCD_E_PIN  , HIGH );
+		reads++;
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(10);
+	/* Repeat Until the LCD is Ready or the Timeout Ends */
+	} while( ( isBusy == HIGH ) && ( reads < LCD_BUSY_TIMEOUT ) );
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Command is Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
 
-		/* Short Delay to Allow the LCD to Process the Received Command */
-		_delay_us(60);
+	/* Set R/W Pin to LOW to Write Again */
+	DIO_SetPinValue( LCD_RW_PORT , LCD_RW_PIN , LOW );
 
-	#endif
 
+	/* Check the LCD mode */
+	#if   LCD_MODE == LCD_4_BITS_MODE
+
+		/*  Set the Direction of the Data Pins back to OUTPUT */
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN0 , OUTPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN1 , OUTPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN2 , OUTPUT );
+		DIO_SetPinDirection( LCD_DATA_PORT , LCD_DATA_PIN3 , OUTPUT );
+
+	#elif LCD_MODE == LCD_8_BITS_MODE
+
+		/*  Set the Direction of the Data Port back to OUTPUT */
+		DIO_SetPortDirection( LCD_DATA_PORT , OUTPUT_PORT );
+
+	#endif
 }
 
+#endif
+
 
 
 
 
 /*
- * @brief Sends a data to the LCD to control its operation.
+ * @brief Sends a byte to the LCD as a command or data.
  *
- * This function sends a data byte to the LCD. The data can either be in 4-bit or 8-bit mode,
- * depending on the LCD configuration. The function sets the appropriate pins for the data,
- * and includes necessary delays for the LCD to process the data.
+ * This function is not intended for direct use by the user. After `LCD_Init` with the command
+ * queue enabled, the byte is only stored in the queue. Otherwise it waits until the LCD is ready
+ * (busy flag or fixed delay) and writes the byte.
  *
- * @param data: The data byte to be sent to the LCD.
+ * @param rs_value: The RS pin value (LOW for a command, HIGH for data).
+ * @param byte:     The byte to be sent to the LCD.
  */
-void LCD_SendData( char data )
+static void LCD_SendByte( uint8 rs_value , uint8 byte )
 {
-	/* Sends a Data to the LCD to Control its Operation */
 
-	/* Check the LCD mode */
-	#if   LCD_MODE == LCD_4_BITS_MODE
-		/* LCD 4 Bits Data mode */
-
-		/* Set RS Pin to LOW for Data mode */
-		DIO_SetPinValue( LCD_RS_PORT , LCD_RS_PIN , HIGH );
+	#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
 
+		/* Check if the Initialization Finished and the Timer Interrupt Drains the Queue */
+		if( LCD_QueueStatus == true )
+		{
+			/* Store the Byte and Return, the Timer Interrupt Sends it */
+			LCD_QueuePush( rs_value , byte );
 
-		/* Send the Higher Nibble (4 Bits) of the Data */
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN0 , GET_BIT( data , 4 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN1 , GET_BIT( data , 5 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN2 , GET_BIT( data , 6 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN3 , GET_BIT( data , 7 ) );
+			return;
+		}
 
+	#endif
 
-		/* Set Enable Pin to High to Signal the LCD that Data is Ready to be Sent */
-		DIO_SetPinValue( LCD_E_PORT  , LCD_E_PIN  , HIGH );
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
-		_delay_us(10);
+	#if LCD_RW_MODE == LCD_RW_CONNECTED
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Data is Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
+		/* Wait Until the LCD Finishes the Previous Operation */
+		LCD_WaitUntilReady();
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
-		_delay_us(10);
+	#endif
 
-		/* Send the Lower Nibble (4 Bits) of the Data */
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN0 , GET_BIT( data , 0 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN1 , GET_BIT( data , 1 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN2 , GET_BIT( data , 2 ) );
-		DIO_SetPinValue( LCD_DATA_PORT , LCD_DATA_PIN3 , GET_BIT( data , 3 ) );
 
-		/* Set Enable Pin to High to Signal the LCD that Data is Ready to be Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , HIGH );
+	/* Write the Byte to the LCD Pins */
+	LCD_WriteByte( rs_value , byte );
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
-		_delay_us(10);
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Data is Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
+	#if ( LCD_RW_MODE == LCD_RW_GROUNDED ) && ( LCD_INTERFACE == LCD_INTERFACE_DIO )
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
+		/* Short Delay to Allow the LCD to Process the Received Byte (the I2C transfer of the next byte is longer) */
 		_delay_us(60);
 
+	#endif
+}
+
 
-	#elif LCD_MODE == LCD_8_BITS_MODE
-		/* LCD 8 Bits Data mode */
 
-		/* Set RS Pin to LOW for Data mode */
-		DIO_SetPinValue( LCD_RS_PORT , LCD_RS_PIN , HIGH );
 
-		/* Send the Data */
-		DIO_SetPortValue( LCD_DATA_PORT , data );
 
-		/* Set Enable Pin to High to Signal the LCD that Data is Ready to be Sent */
-		DIO_SetPinValue( LCD_E_PORT  , LCD_E_PIN  , HIGH );
+/*
+ * @brief Sends a command to the LCD to control its operation.
+ *
+ * This function sends a command byte to the LCD. The command can either be in 4-bit or 8-bit mode,
+ * depending on the LCD configuration. The function sets the appropriate pins for the command,
+ * and includes necessary delays for the LCD to process the command.
+ *
+ * @param command: The command byte to be sent to the LCD.
+ */
+void LCD_SendCommand( uint8 command )
+{
+	/* Set RS Pin to LOW for Command mode and Send the Command */
+	LCD_SendByte( LOW , command );
+}
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
-		_delay_us(10);
 
-		/* Set Enable Pin to Low to Make a Falling Edge to Signal the LCD that Data is Sent */
-		DIO_SetPinValue( LCD_E_PORT , LCD_E_PIN , LOW );
 
-		/* Short Delay to Allow the LCD to Process the Received Data */
-		_delay_us(60);
 
-	#endif
 
+/*
+ * @brief Sends a data to the LCD to control its operation.
+ *
+ * This function sends a data byte to the LCD. The data can either be in 4-bit or 8-bit mode,
+ * depending on the LCD configuration. The function sets the appropriate pins for the data,
+ * and includes necessary delays for the LCD to process the data.
+ *
+ * @param data: The data byte to be sent to the LCD.
+ */
+void LCD_SendData( char data )
+{
+	/* Set RS Pin to HIGH for Data mode and Send the Data */
+	LCD_SendByte( HIGH , data );
 }
 
 
@@ -8,15 +8,21 @@
  *
  * @details
  * This driver provides a complete abstraction for interfacing with character
- * LCD modules (16x2 or 16x4) based on the HD44780 controller. It supports both
+ * LCD modules (16x2, 16x4, 20x2 or 20x4) based on the HD44780 controller. It supports both
  * 4-bit and 8-bit communication modes, initialization, and includes cursor tracking,
  * automatic row shifting, and custom character handling.
  *
  * The LCD driver includes the following functionalities:
  * - Initialization of LCD with configurable data/control pin mapping.
+ * - Optional PCF8574 I2C backpack interface (one I2C transfer per LCD byte).
+ * - Optional R/W pin to wait for the busy flag instead of fixed worst-case delays.
  * - Print characters, strings, and numbers.
  * - Cursor positioning and screen clearing.
+ * - Optional shadow buffer with differential writes (only changed characters are sent).
+ * - Optional command queue drained by a timer interrupt, so the print functions return immediately.
  * - Custom character creation using CGRAM.
+ * - Optional glyph cache that loads more than 8 custom characters to the CGRAM on demand (LRU).
+ * - Optional big digits (2 or 4 rows) and smooth bar graphs (5 levels per cell).
  * - Shift display left/right and get current cursor position.
  *
  * @note
@@ -104,6 +110,174 @@ void LCD_SetCursor( uint8 row , uint8 col );
 void LCD_ClearScreen( void );
 
 
+#if LCD_SHADOW_MODE == LCD_SHADOW_ENABLE
+
+/*
+ * @brief Writes a character to a cell of the LCD only if the cell shows a different character.
+ *
+ * The character is compared with the shadow buffer (the SRAM copy of the display contents).
+ * The cursor is moved only if the cell is not the next cell after the last written one.
+ *
+ * @param row:       The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:       The column number (0 to LCD_NUMBER_OF_COLS-1).
+ * @param character: The character to be displayed in the cell.
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteCharacter( uint8 row , uint8 col , char character );
+
+
+/*
+ * @brief Writes a string to a row of the LCD, sending only the characters that changed.
+ *
+ * Each character is compared with the shadow buffer (the SRAM copy of the display contents),
+ * unchanged characters are skipped, and the cursor is moved only when the next changed
+ * character is not next to the last written one. The string is cut at the end of the row.
+ *
+ * @param row: The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col: The column number (0 to LCD_NUMBER_OF_COLS-1) of the first character.
+ * @param str: The string to be written. The string should be null-terminated.
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteString( uint8 row , uint8 col , const char * str );
+
+
+/*
+ * @brief Writes a signed integer number to a field of the LCD, sending only the characters that changed.
+ *
+ * The number is written from the field start and the rest of the field is filled with blanks,
+ * so a shorter number clears the digits of the previous one.
+ *
+ * @param row:    The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:    The column number (0 to LCD_NUMBER_OF_COLS-1) of the field start.
+ * @param number: The signed integer number to be written.
+ * @param width:  The field width in characters (cut at the end of the row).
+ *
+ * @note The cursor is left after the last changed cell.
+ */
+void LCD_WriteNumber( uint8 row , uint8 col , sint32 number , uint8 width );
+
+#endif
+
+
+#if LCD_GLYPH_CACHE_MODE == LCD_GLYPH_CACHE_ENABLE
+
+/*
+ * @brief Sets the glyph table of the glyph cache and marks all the CGRAM slots empty.
+ *
+ * @param glyph_table: The glyphs in program memory, 8 row bytes per glyph (such as `const uint8 glyphs[][8] PROGMEM`).
+ *                     The glyph ID is the index in the table (0 to 254).
+ *
+ * @note Do not use `LCD_SaveCustomChar` while the glyph cache is used.
+ */
+void LCD_GlyphInit( const uint8 * glyph_table );
+
+
+/*
+ * @brief Returns the character code of a glyph, loading it to the CGRAM only if it is not there.
+ *
+ * A glyph already in a CGRAM slot is reused. Otherwise the least recently used glyph that is
+ * not shown on the screen is replaced, and the 8 bytes of the new glyph are written to its slot.
+ *
+ * @param glyph_id: The glyph index in the glyph table.
+ *
+ * @return uint8 The character code (0 to 7) to print, or LCD_GLYPH_NO_SLOT if all the
+ *               slots hold glyphs shown on the screen.
+ */
+uint8 LCD_GlyphGetCode( uint8 glyph_id );
+
+
+/*
+ * @brief Writes a glyph to a cell of the LCD, loading it to the CGRAM only if it is not there.
+ *
+ * The glyph shown in the cell itself may be replaced, so a cell can change its glyph even
+ * when all the other slots are on the screen. The cell is written only if it changed.
+ *
+ * @param row:      The row number (0 to LCD_NUMBER_OF_ROWS-1).
+ * @param col:      The column number (0 to LCD_NUMBER_OF_COLS-1).
+ * @param glyph_id: The glyph index in the glyph table.
+ *
+ * @return uint8 SUCCESS if the glyph is written, ERROR if the cell is out of range or
+ *               all the slots hold glyphs shown on the screen.
+ */
+uint8 LCD_WriteGlyph( uint8 row , uint8 col , uint8 glyph_id );
+
+#endif
+
+
+#if LCD_GRAPHICS_MODE == LCD_GRAPHICS_ENABLE
+
+/*
+ * @brief Saves the big digit pieces and the bar graph cells to the CGRAM slots 0 to 6.
+ *
+ * This function must be called after `LCD_Init` and before the big digit and bar graph functions.
+ */
+void LCD_GraphicsInit( void );
+
+
+/*
+ * @brief Writes a big digit of 3 columns x 2 or 4 rows composed of custom characters.
+ *
+ * The digit is built from its 7 segments: the vertical segments are full blocks and the
+ * horizontal segments are bar pieces. The column after the digit is written blank.
+ * With the shadow buffer enabled only the changed cells are sent.
+ *
+ * @param row:    The top row of the digit.
+ * @param col:    The left column of the digit.
+ * @param digit:  The digit (0 to 9), LCD_BIG_MINUS or LCD_BIG_BLANK.
+ * @param height: The digit height [ LCD_BIG_2_ROWS , LCD_BIG_4_ROWS ].
+ *
+ * @note The cursor is left after the last written cell.
+ */
+void LCD_WriteBigDigit( uint8 row , uint8 col , uint8 digit , uint8 height );
+
+
+/*
+ * @brief Writes a signed integer number with big digits to a field of the LCD.
+ *
+ * Each digit takes 4 columns (3 for the digit and a blank one). The number is written from
+ * the field start and the rest of the field is filled with blank digits, so a shorter number
+ * clears the digits of the previous one.
+ *
+ * @param row:    The top row of the number.
+ * @param col:    The left column of the field.
+ * @param number: The signed integer number to be written.
+ * @param width:  The field width in digits (cut at the end of the row).
+ * @param height: The digit height [ LCD_BIG_2_ROWS , LCD_BIG_4_ROWS ].
+ *
+ * @note The cursor is left after the last written cell.
+ */
+void LCD_WriteBigNumber( uint8 row , uint8 col , sint32 number , uint8 width , uint8 height );
+
+
+/*
+ * @brief Initializes a horizontal bar graph and draws it empty.
+ *
+ * @param bar:   Pointer to the bar graph structure.
+ * @param row:   The row of the bar.
+ * @param col:   The left column of the bar.
+ * @param width: The number of cells of the bar (5 levels per cell, cut at the end of the row).
+ */
+void LCD_BarInit( LCD_Bar * bar , uint8 row , uint8 col , uint8 width );
+
+
+/*
+ * @brief Sets the value of a bar graph, sending only the cells that changed.
+ *
+ * The bar has 5 levels per cell. When the value moves inside a cell only that boundary cell
+ * is sent, otherwise the cells between the old and the new boundary are sent.
+ *
+ * @param bar:     Pointer to the bar graph structure.
+ * @param percent: The bar value (0 to 100).
+ *
+ * @note The cursor is left after the last written cell.
+ */
+void LCD_BarSetValue( LCD_Bar * bar , uint8 percent );
+
+#endif
+
+
 /*
  * @brief Saves a custom character to the LCD's CGRAM (Character Generator RAM).
  *
@@ -155,6 +329,46 @@ void LCD_ShiftDisplayLeft( void );
 void LCD_ShiftDisplayRight( void );
 
 
+#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
+/*
+ * @brief Turns the backlight of a PCF8574 backpack on or off.
+ *
+ * The backlight bit is kept in all the next expander writes.
+ *
+ * @param backlight_status: The backlight status [ LCD_BACKLIGHT_OFF , LCD_BACKLIGHT_ON ].
+ */
+void LCD_SetBacklight( uint8 backlight_status );
+
+#endif
+
+
+#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+/*
+ * @brief Returns whether all the queued commands and data were sent to the LCD.
+ *
+ * The queue is empty when the timer interrupt has sent every entry and the LCD
+ * finished the last clear screen or return home command.
+ *
+ * @return uint8 true if the queue is empty, false if entries are still waiting.
+ */
+uint8 LCD_IsQueueEmpty( void );
+
+
+/*
+ * @brief Sends one entry of the command queue to the LCD on each timer compare match.
+ *
+ * This function is called by the timer compare match interrupt every `LCD_QUEUE_TICK_US`,
+ * which covers the execution time of one byte. With LCD_QUEUE_TIMER_MANUAL call it from
+ * your own periodic interrupt instead. After a clear screen or return home command it
+ * skips the ticks needed for the long execution time.
+ */
+void LCD_QueueTick( void );
+
+#endif
+
+
 /*
  * @brief Sends a command to the LCD to control its operation.
  *
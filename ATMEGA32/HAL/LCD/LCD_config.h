@@ -8,8 +8,8 @@
  *
  * @details
  * This file contains configuration options for the LCD driver.
- * It allows the user to define the LCD's operational mode, pin connections,
- * cursor behavior, and auto row movement features. Adjusting these settings
+ * It allows the user to define the LCD's operational mode, interface (DIO or PCF8574 I2C), pin connections, busy flag usage,
+ * cursor behavior, auto row movement, shadow buffer, glyph cache, graphics and command queue features. Adjusting these settings
  * tailors the driver to specific hardware configurations and display preferences.
  *
  * @note
@@ -26,6 +26,7 @@
 #define LCD_CONFIG_H_
 
 #include "LCD_def.h"
+#include "../../MCAL/DIO/DIO.h"
 
 
 /*Set number rows in the LCD
@@ -36,6 +37,14 @@
 #define LCD_NUMBER_OF_ROWS					LCD_2_ROWS
 
 
+/*Set number columns in the LCD
+ * choose between:
+ * 1. LCD_16_COLS							<--the most used
+ * 2. LCD_20_COLS
+ */
+#define LCD_NUMBER_OF_COLS					LCD_16_COLS
+
+
 /*Set number of data bits mode
  * choose between:
  * 1. LCD_4_BITS_MODE						<--the most used
@@ -45,6 +54,42 @@
 
 
 
+/*Set the LCD Interface
+ * choose between:
+ * 1. LCD_INTERFACE_DIO						<--the most used (the pins below)
+ * 2. LCD_INTERFACE_PCF8574					(I2C backpack, needs LCD_4_BITS_MODE and LCD_RW_GROUNDED)
+ */
+#define LCD_INTERFACE						LCD_INTERFACE_DIO
+
+
+/*Set the PCF8574 7-bit I2C Address (used only with LCD_INTERFACE_PCF8574)
+ * 0x20 to 0x27 for the PCF8574 and 0x38 to 0x3F for the PCF8574A (A0, A1, A2 pins)
+ */
+#define LCD_PCF8574_ADDRESS					0x27	//<--the most used 0x27
+
+
+/*Set the PCF8574 Bit (P0 to P7) Connected to each LCD Pin (used only with LCD_INTERFACE_PCF8574)
+ * The most used backpack: P0=RS P1=R/W P2=E P3=backlight P4=D4 P5=D5 P6=D6 P7=D7
+ */
+#define LCD_PCF8574_RS_BIT					0
+#define LCD_PCF8574_RW_BIT					1
+#define LCD_PCF8574_E_BIT					2
+#define LCD_PCF8574_BACKLIGHT_BIT			3
+#define LCD_PCF8574_D4_BIT					4
+#define LCD_PCF8574_D5_BIT					5
+#define LCD_PCF8574_D6_BIT					6
+#define LCD_PCF8574_D7_BIT					7
+
+
+/*Set the Backlight Status after Initialization (used only with LCD_INTERFACE_PCF8574)
+ * choose between:
+ * 1. LCD_BACKLIGHT_OFF
+ * 2. LCD_BACKLIGHT_ON						<--the most used
+ */
+#define LCD_BACKLIGHT_STATUS				LCD_BACKLIGHT_ON
+
+
+
 /*Set the DIO Port For the LCD RS Pin
  * choose between:
  * 1. DIO_PORTA
@@ -95,6 +140,45 @@
 
 
 
+/*Set the LCD R/W Pin Mode
+ * choose between:
+ * 1. LCD_RW_GROUNDED						<--the most used (fixed delays)
+ * 2. LCD_RW_CONNECTED						(busy flag polling, faster)
+ */
+#define LCD_RW_MODE							LCD_RW_GROUNDED
+
+
+/*Set the DIO Port For the LCD R/W Pin (used only with LCD_RW_CONNECTED)
+ * choose between:
+ * 1. DIO_PORTA
+ * 2. DIO_PORTB
+ * 3. DIO_PORTC
+ * 4. DIO_PORTD
+ */
+#define LCD_RW_PORT							DIO_PORTC
+
+
+/*Set the DIO Pin For the LCD R/W Pin (used only with LCD_RW_CONNECTED)
+ * choose between:
+ * 1. DIO_PIN0
+ * 2. DIO_PIN1
+ * 3. DIO_PIN2
+ * 4. DIO_PIN3
+ * 5. DIO_PIN4
+ * 6. DIO_PIN5
+ * 7. DIO_PIN6
+ * 8. DIO_PIN7
+ */
+#define LCD_RW_PIN							DIO_PIN6
+
+
+/*Set the Maximum Number of Busy Flag Reads Before Sending Anyway (valid range: 1 - 65535)
+ * One read takes about 10 us, so it must cover the clear screen command (1.52 ms)
+ */
+#define LCD_BUSY_TIMEOUT					500		//<--the most used 500
+
+
+
 /*Set the DIO Port For the LCD Data Pins
  * choose between:
  * 1. DIO_PORTA
@@ -143,4 +227,278 @@
 #define LCD_AUTO_MOVE_MODE					LCD_AUTO_MOVE_ROW_DISABLE
 
 
+
+/*Set the Shadow Buffer Mode
+ * Choose between:
+ * 1. LCD_SHADOW_DISABLE					<--the default
+ * 2. LCD_SHADOW_ENABLE						(uses LCD_NUMBER_OF_ROWS x LCD_NUMBER_OF_COLS bytes of SRAM)
+ */
+#define LCD_SHADOW_MODE						LCD_SHADOW_DISABLE
+
+
+
+/*Set the Glyph Cache Mode (needs LCD_SHADOW_ENABLE to know which glyphs are on the screen)
+ * Choose between:
+ * 1. LCD_GLYPH_CACHE_DISABLE				<--the default
+ * 2. LCD_GLYPH_CACHE_ENABLE					(more than 8 custom characters from a table in program memory)
+ */
+#define LCD_GLYPH_CACHE_MODE				LCD_GLYPH_CACHE_DISABLE
+
+
+
+/*Set the Graphics Mode (big digits and bar graphs)
+ * Choose between:
+ * 1. LCD_GRAPHICS_DISABLE					<--the default
+ * 2. LCD_GRAPHICS_ENABLE					(uses the CGRAM slots 0 to 6)
+ */
+#define LCD_GRAPHICS_MODE					LCD_GRAPHICS_DISABLE
+
+
+
+/*Set the Command Queue Mode
+ * Choose between:
+ * 1. LCD_QUEUE_DISABLE						<--the default (each function waits until the LCD executes the byte)
+ * 2. LCD_QUEUE_ENABLE						(the functions return immediately, a timer compare interrupt sends the bytes)
+ */
+#define LCD_QUEUE_MODE						LCD_QUEUE_DISABLE
+
+
+/*Set the Timer that Drains the Command Queue (used only with LCD_QUEUE_ENABLE)
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled,
+ * the driver sets the compare value from LCD_QUEUE_TICK_US
+ * choose between:
+ * 1. LCD_QUEUE_TIMER_MANUAL				(call LCD_QueueTick() every LCD_QUEUE_TICK_US from your own periodic interrupt)
+ * 2. LCD_QUEUE_TIMER0
+ * 3. LCD_QUEUE_TIMER2						<--the most used
+ */
+#define LCD_QUEUE_TIMER						LCD_QUEUE_TIMER2
+
+
+/*Set the Number of Entries in the Command Queue (used only with LCD_QUEUE_ENABLE)
+ * Each entry uses 2 bytes of SRAM
+ * choose between:
+ * 1. 16
+ * 2. 32
+ * 3. 64									<--the most used (a full 16x2 screen with the cursor commands)
+ * 4. 128
+ */
+#define LCD_QUEUE_SIZE						64
+
+
+/*Set the Period of the Timer Compare Match Interrupt in us (valid range: 40 - 2000)
+ * One entry is sent per period, so it must cover the LCD execution time (40 us)
+ */
+#define LCD_QUEUE_TICK_US					50		//<--the most used 50
+
+
+
+/* Error checking for invalid configurations */
+#if ( LCD_RW_MODE == LCD_RW_GROUNDED ) && ( LCD_QUEUE_MODE == LCD_QUEUE_ENABLE )
+	#define LCD_ENABLE_PULSE_DELAY			1		/*Enable pulse delay in us, the datasheet minimum (450 ns pulse width), kept short inside the timer interrupt*/
+#elif LCD_RW_MODE == LCD_RW_GROUNDED
+	#define LCD_ENABLE_PULSE_DELAY			10		/*Enable pulse delay in us, long enough without checking the LCD*/
+#elif LCD_RW_MODE == LCD_RW_CONNECTED
+	#define LCD_ENABLE_PULSE_DELAY			1		/*Enable pulse delay in us, the datasheet minimum (450 ns pulse width), the busy flag covers the execution time*/
+#else
+	#error "Wrong \"LCD_RW_MODE\" configuration option"
+#endif
+
+#if ( LCD_RW_MODE == LCD_RW_CONNECTED ) && ( ( LCD_BUSY_TIMEOUT < 1 ) || ( LCD_BUSY_TIMEOUT > 65535 ) )
+	#error "the LCD_BUSY_TIMEOUT value not in range"
+#endif
+
+/*RS pin port register, written directly instead of calling the DIO functions*/
+#if   LCD_RS_PORT == DIO_PORTA
+	#define LCD_RS_PORT_REG				PORTA
+#elif LCD_RS_PORT == DIO_PORTB
+	#define LCD_RS_PORT_REG				PORTB
+#elif LCD_RS_PORT == DIO_PORTC
+	#define LCD_RS_PORT_REG				PORTC
+#elif LCD_RS_PORT == DIO_PORTD
+	#define LCD_RS_PORT_REG				PORTD
+#else
+	#error "Wrong \"LCD_RS_PORT\" configuration option"
+#endif
+
+/*E pin port register, written directly instead of calling the DIO functions*/
+#if   LCD_E_PORT == DIO_PORTA
+	#define LCD_E_PORT_REG				PORTA
+#elif LCD_E_PORT == DIO_PORTB
+	#define LCD_E_PORT_REG				PORTB
+#elif LCD_E_PORT == DIO_PORTC
+	#define LCD_E_PORT_REG				PORTC
+#elif LCD_E_PORT == DIO_PORTD
+	#define LCD_E_PORT_REG				PORTD
+#else
+	#error "Wrong \"LCD_E_PORT\" configuration option"
+#endif
+
+/*Data pins port register, written directly instead of calling the DIO functions*/
+#if   LCD_DATA_PORT == DIO_PORTA
+	#define LCD_DATA_PORT_REG				PORTA
+#elif LCD_DATA_PORT == DIO_PORTB
+	#define LCD_DATA_PORT_REG				PORTB
+#elif LCD_DATA_PORT == DIO_PORTC
+	#define LCD_DATA_PORT_REG				PORTC
+#elif LCD_DATA_PORT == DIO_PORTD
+	#define LCD_DATA_PORT_REG				PORTD
+#else
+	#error "Wrong \"LCD_DATA_PORT\" configuration option"
+#endif
+
+#if LCD_MODE == LCD_4_BITS_MODE
+
+	/*Data pins mask in the data port*/
+	#define LCD_DATA_PINS_MASK				( ( 1 << LCD_DATA_PIN0 ) | ( 1 << LCD_DATA_PIN1 ) | ( 1 << LCD_DATA_PIN2 ) | ( 1 << LCD_DATA_PIN3 ) )
+
+	/*Check if the data pins are contiguous to write the nibble with a shift, or use a pin map*/
+	#if ( LCD_DATA_PIN1 == LCD_DATA_PIN0 + 1 ) && ( LCD_DATA_PIN2 == LCD_DATA_PIN0 + 2 ) && ( LCD_DATA_PIN3 == LCD_DATA_PIN0 + 3 )
+		#define LCD_DATA_PINS_ORDER			LCD_DATA_PINS_CONTIGUOUS
+	#else
+		#define LCD_DATA_PINS_ORDER			LCD_DATA_PINS_MAPPED
+	#endif
+
+	/*Data port bits of a nibble value (used to build the pin map)*/
+	#define LCD_NIBBLE_PINS( nibble )		( ( ( ( nibble ) >> 0 ) & 0x01 ) << LCD_DATA_PIN0 | \
+											  ( ( ( nibble ) >> 1 ) & 0x01 ) << LCD_DATA_PIN1 | \
+											  ( ( ( nibble ) >> 2 ) & 0x01 ) << LCD_DATA_PIN2 | \
+											  ( ( ( nibble ) >> 3 ) & 0x01 ) << LCD_DATA_PIN3 )
+
+#endif
+
+#if LCD_INTERFACE == LCD_INTERFACE_PCF8574
+
+	#include "../../MCAL/I2C/I2C.h"
+
+	/* You must initialize I2C manually "I2C_Init()" before using this driver */
+	#ifndef I2C_IN_HAL
+	#define I2C_IN_HAL
+		#warning "⚠️ Initialize I2C manually before using this driver."
+	#endif
+
+	#if LCD_MODE != LCD_4_BITS_MODE
+		#error "LCD_INTERFACE_PCF8574 needs LCD_4_BITS_MODE"
+	#endif
+
+	#if LCD_RW_MODE != LCD_RW_GROUNDED
+		#error "LCD_INTERFACE_PCF8574 needs LCD_RW_GROUNDED (the R/W pin is held low by the expander)"
+	#endif
+
+	#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+		#error "LCD_QUEUE_ENABLE needs LCD_INTERFACE_DIO (an I2C transfer is too long for the timer interrupt)"
+	#endif
+
+	/*Expander bits of a nibble value on the D4 to D7 pins*/
+	#define LCD_PCF8574_NIBBLE( nibble )	( ( ( ( nibble ) >> 0 ) & 0x01 ) << LCD_PCF8574_D4_BIT | \
+											  ( ( ( nibble ) >> 1 ) & 0x01 ) << LCD_PCF8574_D5_BIT | \
+											  ( ( ( nibble ) >> 2 ) & 0x01 ) << LCD_PCF8574_D6_BIT | \
+											  ( ( ( nibble ) >> 3 ) & 0x01 ) << LCD_PCF8574_D7_BIT )
+
+#elif LCD_INTERFACE != LCD_INTERFACE_DIO
+	#error "Wrong \"LCD_INTERFACE\" configuration option"
+#endif
+
+#if ( LCD_GLYPH_CACHE_MODE == LCD_GLYPH_CACHE_ENABLE ) && ( LCD_SHADOW_MODE != LCD_SHADOW_ENABLE )
+	#error "LCD_GLYPH_CACHE_ENABLE needs LCD_SHADOW_ENABLE"
+#endif
+
+#if ( LCD_GRAPHICS_MODE == LCD_GRAPHICS_ENABLE ) && ( LCD_GLYPH_CACHE_MODE == LCD_GLYPH_CACHE_ENABLE )
+	#error "LCD_GRAPHICS_ENABLE and LCD_GLYPH_CACHE_ENABLE both use the CGRAM slots"
+#endif
+
+#if LCD_QUEUE_MODE == LCD_QUEUE_ENABLE
+
+	#if ( LCD_QUEUE_SIZE != 16 ) && ( LCD_QUEUE_SIZE != 32 ) && ( LCD_QUEUE_SIZE != 64 ) && ( LCD_QUEUE_SIZE != 128 )
+		#error "Wrong \"LCD_QUEUE_SIZE\" configuration option"
+	#endif
+
+	#if ( LCD_QUEUE_TICK_US < 40 ) || ( LCD_QUEUE_TICK_US > 2000 )
+		#error "the LCD_QUEUE_TICK_US value not in range"
+	#endif
+
+	/*Number of extra ticks to wait after the clear screen and return home commands*/
+	#define LCD_QUEUE_LONG_WAIT_TICKS		( ( LCD_LONG_EXECUTION_US + LCD_QUEUE_TICK_US - 1 ) / LCD_QUEUE_TICK_US - 1 )
+
+	#ifndef F_CPU
+		#define F_CPU 8000000UL
+		#warning "F_CPU not defined! Assuming 8MHz."
+	#endif
+
+	#if   LCD_QUEUE_TIMER == LCD_QUEUE_TIMER_MANUAL
+
+		/* LCD_QueueTick() is called by the user */
+
+	#elif LCD_QUEUE_TIMER == LCD_QUEUE_TIMER0
+
+		#include "../../MCAL/TIMER0/TIMER0.h"
+
+		/* You must initialize Timer0 manually "TIMER0_Init()" before using the command queue */
+		#ifndef TIMER0_IN_HAL
+		#define TIMER0_IN_HAL
+			#warning "⚠️ Initialize Timer0 manually before using the LCD command queue."
+		#endif
+
+		/* Only one driver can use the Timer0 compare match */
+		#ifdef TIMER0_COMP_CLAIMED
+			#error "The Timer0 compare match is used by another driver, change LCD_QUEUE_TIMER"
+		#endif
+		#define TIMER0_COMP_CLAIMED
+
+		/* Configure Timer0 to CTC mode */
+		#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+			#warning "⚠️ Configure Timer0 in CTC mode."
+		#endif
+
+		/* Enable Timer0 compare match interrupt */
+		#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer0 compare match interrupt."
+		#endif
+
+		/*Timer compare value of one queue tick (rounded up, so the tick is never shorter than LCD_QUEUE_TICK_US)*/
+		#define LCD_QUEUE_TIMER_TOP			( ( ( LCD_QUEUE_TICK_US * ( F_CPU / 1000000UL ) + TIMER0_PRESCALER - 1 ) / TIMER0_PRESCALER ) - 1 )
+
+		#if ( LCD_QUEUE_TIMER_TOP < 1 ) || ( LCD_QUEUE_TIMER_TOP > 255 )
+			#error "LCD_QUEUE_TICK_US does not fit Timer0, change it or the timer prescaler"
+		#endif
+
+	#elif LCD_QUEUE_TIMER == LCD_QUEUE_TIMER2
+
+		#include "../../MCAL/TIMER2/TIMER2.h"
+
+		/* You must initialize Timer2 manually "TIMER2_Init()" before using the command queue */
+		#ifndef TIMER2_IN_HAL
+		#define TIMER2_IN_HAL
+			#warning "⚠️ Initialize Timer2 manually before using the LCD command queue."
+		#endif
+
+		/* Only one driver can use the Timer2 compare match */
+		#ifdef TIMER2_COMP_CLAIMED
+			#error "The Timer2 compare match is used by another driver, change LCD_QUEUE_TIMER"
+		#endif
+		#define TIMER2_COMP_CLAIMED
+
+		/* Configure Timer2 to CTC mode */
+		#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+			#warning "⚠️ Configure Timer2 in CTC mode."
+		#endif
+
+		/* Enable Timer2 compare match interrupt */
+		#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer2 compare match interrupt."
+		#endif
+
+		/*Timer compare value of one queue tick (rounded up, so the tick is never shorter than LCD_QUEUE_TICK_US)*/
+		#define LCD_QUEUE_TIMER_TOP			( ( ( LCD_QUEUE_TICK_US * ( F_CPU / 1000000UL ) + TIMER2_PRESCALER - 1 ) / TIMER2_PRESCALER ) - 1 )
+
+		#if ( LCD_QUEUE_TIMER_TOP < 1 ) || ( LCD_QUEUE_TIMER_TOP > 255 )
+			#error "LCD_QUEUE_TICK_US does not fit Timer2, change it or the timer prescaler"
+		#endif
+
+	#else
+		#error "Wrong \"LCD_QUEUE_TIMER\" configuration option"
+	#endif
+
+#endif
+
+
 #endif /* LCD_CONFIG_H_ */
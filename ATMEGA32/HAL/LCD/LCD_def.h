@@ -11,7 +11,7 @@
  * It includes instruction command codes, memory address mappings, and configuration
  * constants for various display modes and LCD sizes. These values are based on the
  * HD44780 LCD controller datasheet and are compatible with common LCD modules
- * such as 16x2 and 16x4.
+ * such as 16x2, 16x4, 20x2 and 20x4.
  *
  *
  * @contact
@@ -23,6 +23,9 @@
 #ifndef LCD_DEF_H_
 #define LCD_DEF_H_
 
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/PGM_SPACE.h"
+
 
 /*------------------------------------------   values    ----------------------------------------*/
 
@@ -55,14 +58,41 @@
 /*LCD Rows Address*/
 #define LCD_FIRST_ROW_ADDRESS				0x00	/*First  Row (Row 0) address*/
 #define LCD_SECOND_ROW_ADDRESS				0x40	/*Second Row (Row 1) address*/
-#define LCD_THIRD_ROW_ADDRESS				0x10	/*Third  Row (Row 2) address*/
-#define LCD_FOURTH_ROW_ADDRESS				0x50	/*Fourth Row (Row 3) address*/
+#define LCD_THIRD_ROW_ADDRESS				( LCD_FIRST_ROW_ADDRESS  + LCD_NUMBER_OF_COLS )	/*Third  Row (Row 2) address, continues the first  row (0x10 for 16 columns, 0x14 for 20 columns)*/
+#define LCD_FOURTH_ROW_ADDRESS				( LCD_SECOND_ROW_ADDRESS + LCD_NUMBER_OF_COLS )	/*Fourth Row (Row 3) address, continues the second row (0x50 for 16 columns, 0x54 for 20 columns)*/
 
 /*LCD Char Size*/
 #define LCD_CHAR_SIZE						8		/*Number of bytes used in one LCD char (digit)*/
 
-/*LCD Column Number*/
-#define LCD_COLS_NUM						16		/*Number of columns in one LCD line*/
+/*LCD Execution Time*/
+#define LCD_LONG_EXECUTION_US				1640	/*Execution time of the clear screen and return home commands in us (the other commands take 40 us)*/
+
+/*LCD Data Pins Order (Set Automatically)*/
+#define LCD_DATA_PINS_CONTIGUOUS			0		/*The 4 data pins are ordered and next to each other, the nibble is shifted to the first pin*/
+#define LCD_DATA_PINS_MAPPED				1		/*The 4 data pins are in any order, the port bits of each nibble are read from a map*/
+
+/*LCD Glyph Cache*/
+#define LCD_CGRAM_SLOTS						8		/*Number of custom characters in the CGRAM (character codes 0 to 7)*/
+#define LCD_GLYPH_EMPTY						0xFF	/*Glyph ID of a CGRAM slot that does not hold a glyph*/
+#define LCD_GLYPH_NO_SLOT					0xFF	/*Returned when all the CGRAM slots hold glyphs shown on the screen*/
+
+/*LCD Graphics Characters*/
+#define LCD_BIG_UPPER_CODE					0		/*CGRAM code of the big digit upper bar piece (rows 0 to 2)*/
+#define LCD_BIG_LOWER_CODE					1		/*CGRAM code of the big digit lower bar piece (rows 5 to 7)*/
+#define LCD_BIG_BOTH_CODE					2		/*CGRAM code of the big digit upper and lower bars piece*/
+#define LCD_BAR_FIRST_CODE					3		/*CGRAM code of the bar cell with 1 column, codes 3 to 6 hold 1 to 4 columns*/
+#define LCD_FULL_BLOCK						0xFF	/*Character ROM code of a fully filled cell*/
+#define LCD_BAR_CELL_COLUMNS				5		/*Number of pixel columns in one cell (sub-columns of a bar graph)*/
+#define LCD_BIG_DIGIT_WIDTH					3		/*Number of columns of a big digit (a blank column follows it)*/
+#define LCD_BIG_MINUS						10		/*Index of the minus sign in the big digit segments*/
+#define LCD_BIG_BLANK						11		/*Index of a blank big digit in the big digit segments*/
+
+/*LCD Big Digit Height*/
+#define LCD_BIG_2_ROWS						2		/*Big digits of 3 columns x 2 rows*/
+#define LCD_BIG_4_ROWS						4		/*Big digits of 3 columns x 4 rows (LCD with 4 rows)*/
+
+/*LCD Blank Character*/
+#define LCD_BLANK_CHARACTER					' '		/*Character code of an empty cell (the clear screen command fills the DDRAM with it)*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -73,9 +103,59 @@
 #define LCD_2_ROWS							2		/*For LCD with 2 display rows (16x2)*/
 #define LCD_4_ROWS							4		/*For LCD with 4 display rows (16x4)*/
 
+/*the Number of LCD Columns*/
+#define LCD_16_COLS							16		/*For LCD with 16 display columns (16x2, 16x4)*/
+#define LCD_20_COLS							20		/*For LCD with 20 display columns (20x2, 20x4)*/
+
 /*the Automatic Move Mode*/
 #define LCD_AUTO_MOVE_ROW_DISABLE			0		/*Do not move to the second row automatically*/
 #define LCD_AUTO_MOVE_ROW_ENABLE			1		/*Automatically move to the second row When the first row ends (current column is number 16 in first row)*/
+
+/*the LCD Interface*/
+#define LCD_INTERFACE_DIO					0		/*The LCD pins are connected to DIO pins (parallel)*/
+#define LCD_INTERFACE_PCF8574				1		/*The LCD pins are connected to a PCF8574 I2C expander (I2C backpack), 4-bit mode only*/
+
+/*the Backlight Status (PCF8574 interface)*/
+#define LCD_BACKLIGHT_OFF					0		/*Backlight transistor off*/
+#define LCD_BACKLIGHT_ON					1		/*Backlight transistor on*/
+
+/*the R/W Pin Mode*/
+#define LCD_RW_GROUNDED						0		/*The R/W pin is connected to GND, wait the worst-case time after each command or data*/
+#define LCD_RW_CONNECTED					1		/*The R/W pin is connected to a DIO pin, read the busy flag and continue as soon as the LCD is ready*/
+
+/*the Shadow Buffer Mode*/
+#define LCD_SHADOW_DISABLE					0		/*No copy of the display contents in SRAM*/
+#define LCD_SHADOW_ENABLE					1		/*Keep a copy of the display contents in SRAM, the LCD_Write functions send only the changed characters*/
+
+/*the Glyph Cache Mode*/
+#define LCD_GLYPH_CACHE_DISABLE				0		/*The CGRAM slots are managed by the user with LCD_SaveCustomChar*/
+#define LCD_GLYPH_CACHE_ENABLE				1		/*Glyphs are loaded to the CGRAM slots on demand, replacing the least recently used glyph not on the screen*/
+
+/*the Graphics Mode*/
+#define LCD_GRAPHICS_DISABLE				0		/*No big digits and bar graphs*/
+#define LCD_GRAPHICS_ENABLE					1		/*Big digits and bar graphs drawn with the CGRAM slots 0 to 6*/
+
+/*the Command Queue Mode*/
+#define LCD_QUEUE_DISABLE					0		/*Send each command or data and wait until the LCD executes it (blocking)*/
+#define LCD_QUEUE_ENABLE					1		/*Store each command or data in a queue and return, a timer compare interrupt sends one entry per tick*/
+
+/*the Command Queue Timer*/
+#define LCD_QUEUE_TIMER_MANUAL				0		/*LCD_QueueTick() is called by the user from any periodic interrupt*/
+#define LCD_QUEUE_TIMER0					1		/*Drain the queue from the Timer0 compare match interrupt*/
+#define LCD_QUEUE_TIMER2					2		/*Drain the queue from the Timer2 compare match interrupt*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Structure to hold a horizontal bar graph*/
+typedef struct {
+	uint8 row;								/*Row of the bar*/
+	uint8 col;								/*First (left) column of the bar*/
+	uint8 width;							/*Number of cells of the bar*/
+	uint8 level;							/*Filled pixel columns currently drawn (0 to width * 5)*/
+}LCD_Bar;
 /*_______________________________________________________________________________________________*/
 
 
@@ -0,0 +1,318 @@
+/****************************************************************************
+ * @file    LEDMUX.c
+ * @author  Boles Medhat
+ * @brief   LED Multiplexer Source File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This driver refreshes a multiplexed LED display through two chained 74HC595 shift
+ * registers driven by the Shift driver: an 8-digit 7-segment display or an 8x8 LED matrix.
+ * A timer compare match interrupt shifts one line (digit or row) per tick from a display
+ * buffer, so the application only updates the buffer.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the refresh timer in CTC mode with the compare match
+ * 				   interrupt enabled (unless LEDMUX_TIMER_MANUAL), and the SPI (with
+ *	 	 	 	   SHIFT_INTERFACE_SPI), **before** calling LEDMUX_Init(). This driver does not
+ *	 	 	 	   initialize them internally.
+ * - Two chained 74HC595 are used: the first one (next to the MCU) drives the data lines
+ *   (segments or columns) and the second one drives the select lines (digits or rows).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "LEDMUX.h"
+
+
+/* Digit Patterns on a 7-Segment Display */
+static const uint8 LEDMUX_DigitArray[10] = LEDMUX_DIGITS_ARRAY;
+
+
+/* Display Buffer, the Lit LEDs of each Line */
+volatile uint8 LEDMUX_Buffer[ LEDMUX_MAX_LINES ];
+
+
+/* Lit and Dark Parts of each Line Period and the Displayed Line */
+MuxPhase LEDMUX_Phase;
+
+
+
+
+
+/*
+ * @brief Shifts the data and select lines to the registers and latches them together.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param select: Select register outputs.
+ * @param data:   Data register outputs.
+ */
+static void LEDMUX_Output( uint8 select , uint8 data )
+{
+
+	/* The Select Register is the Second in the Chain, so it is Shifted First */
+	SHIFT_OUT_Byte( select );
+	SHIFT_OUT_Byte( data );
+
+	/* Change the Line and its LEDs at the Same Time */
+	SHIFT_OUT_Latch();
+}
+
+
+
+
+
+/*
+ * @brief Refreshes the display by one part of a line period.
+ *
+ * Each line period starts by shifting the next line with its LEDs for its lit part, then
+ * all the lines are dark for its dark part (the brightness, see MUX_PHASE). With
+ * LEDMUX_TIMER0 or 2 the driver calls this function from the timer interrupt. With
+ * LEDMUX_TIMER_MANUAL call it from your own timer compare interrupt and load the returned
+ * length minus 1 to the compare value (at full brightness a fixed periodic interrupt also
+ * works, one line per call).
+ *
+ * @return Length of the part that starts, in timer ticks.
+ */
+uint8 LEDMUX_Tick( void )
+{
+
+	uint8 ticks;
+
+
+	/* Move to the Next Part of the Period */
+	ticks = MUX_PHASE_Next( & LEDMUX_Phase , LEDMUX_LINES_NUM );
+
+	/* Shift the Lit Line with its LEDs or Turn All the Lines Off */
+	if( LEDMUX_Phase.Lit == true )
+	{
+		LEDMUX_Output( ( 1 << LEDMUX_Phase.Line ) ^ LEDMUX_SELECT_OFF , LEDMUX_Buffer[ LEDMUX_Phase.Line ] ^ LEDMUX_DATA_OFF );
+	}
+	else
+	{
+		LEDMUX_Output( LEDMUX_SELECT_OFF , LEDMUX_DATA_OFF );
+	}
+
+	return ticks;
+}
+
+
+
+
+
+#if LEDMUX_TIMER != LEDMUX_TIMER_MANUAL
+
+/*
+ * @brief Timer compare match handler that refreshes the display.
+ *
+ * This function is not intended for direct use by the user. It refreshes one part of the
+ * line period and sets its length as the compare value.
+ */
+static void LEDMUX_RefreshInterrupt( void )
+{
+
+	/* Set the Length of this Part (the CTC Timer Counts from 0 to the Compare Value) */
+	#if   LEDMUX_TIMER == LEDMUX_TIMER0
+		TIMER0_SetCompareValue( LEDMUX_Tick() - 1 );
+	#elif LEDMUX_TIMER == LEDMUX_TIMER2
+		TIMER2_SetCompareValue( LEDMUX_Tick() - 1 );
+	#endif
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Initializes the LED multiplexer and starts refreshing the display.
+ *
+ * This function initializes the shift register pins, clears the display buffer,
+ * sets the full brightness and sets the timer compare match callback.
+ */
+void LEDMUX_Init( void )
+{
+
+	/* Initialize the Shift Register Pins */
+	SHIFT_OUT_Init();
+
+	LEDMUX_Clear();
+	LEDMUX_SetBrightness( LEDMUX_BRIGHTNESS_MAX );
+
+	/* Set the Timer Compare Match Interrupt Callback to Refresh the Display */
+	#if   LEDMUX_TIMER == LEDMUX_TIMER0
+		TIMER0_SetCallback( TIMER0_COMP_ID , & LEDMUX_RefreshInterrupt );
+	#elif LEDMUX_TIMER == LEDMUX_TIMER2
+		TIMER2_SetCallback( TIMER2_COMP_ID , & LEDMUX_RefreshInterrupt );
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Turns off all the LEDs of the display buffer.
+ */
+void LEDMUX_Clear( void )
+{
+	for( uint8 line = 0 ; line < LEDMUX_LINES_NUM ; line++ )
+	{
+		LEDMUX_Buffer[ line ] = 0;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the LEDs of one line (raw segment pattern or matrix row).
+ *
+ * @param line:    Line number (0 to LEDMUX_LINES_NUM - 1).
+ * @param pattern: Lit LEDs (bit n set lights data line n, for a digit bit 0 to 6 are
+ *                 segments A to G and bit 7 is the decimal point).
+ */
+void LEDMUX_SetLine( uint8 line , uint8 pattern )
+{
+
+	/* Check that the Line is Valid */
+	if( line < LEDMUX_LINES_NUM )
+	{
+		LEDMUX_Buffer[ line ] = pattern;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Turns one LED of an LED matrix on or off.
+ *
+ * @param row:    Row (select line) of the LED (0 to LEDMUX_LINES_NUM - 1).
+ * @param col:    Column (data line) of the LED (0 to 7).
+ * @param status: true to light the LED, false to turn it off.
+ */
+void LEDMUX_SetPixel( uint8 row , uint8 col , uint8 status )
+{
+
+	/* Check that the Row and the Column are Valid */
+	if( ( row < LEDMUX_LINES_NUM ) && ( col < 8 ) )
+	{
+		/* Change the LED without Interrupting in the Middle of the Read-Modify-Write */
+		uint8 sreg = SREG;
+		CLR_BIT( SREG , I );
+
+		if( status == true )
+		{
+			SET_BIT( LEDMUX_Buffer[ row ] , col );
+		}
+		else
+		{
+			CLR_BIT( LEDMUX_Buffer[ row ] , col );
+		}
+
+		SREG = sreg;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Shows a digit (0 to 9) at a position of a 7-segment display.
+ *
+ * The decimal point of the position does not change.
+ *
+ * @param position: Digit position (0 is the digit on select line 0).
+ * @param digit:    Digit to display (0 to 9).
+ */
+void LEDMUX_SetDigit( uint8 position , uint8 digit )
+{
+
+	/* Check that the Position and the Digit are Valid */
+	if( ( position < LEDMUX_LINES_NUM ) && ( digit < 10 ) )
+	{
+		/* Keep the Decimal Point of the Position */
+		LEDMUX_Buffer[ position ] = LEDMUX_DigitArray[ digit ] | ( LEDMUX_Buffer[ position ] & ( 1 << LEDMUX_DOT_BIT ) );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Turns the decimal point of a position of a 7-segment display on or off.
+ *
+ * @param position: Digit position (0 is the digit on select line 0).
+ * @param status:   true to light the decimal point, false to turn it off.
+ */
+void LEDMUX_SetDot( uint8 position , uint8 status )
+{
+	LEDMUX_SetPixel( position , LEDMUX_DOT_BIT , status );
+}
+
+
+
+
+
+/*
+ * @brief Shows a number on a 7-segment display.
+ *
+ * The last position shows the units and position 0 the highest digit, with leading zeros.
+ * The decimal points do not change.
+ *
+ * @param number: The numeric value to be displayed.
+ */
+void LEDMUX_SetNumber( uint32 number )
+{
+
+	/* Loop on the Digits from the Units */
+	for( sint8 position = LEDMUX_LINES_NUM - 1 ; position >= 0 ; position-- )
+	{
+		LEDMUX_SetDigit( position , number % 10 );
+
+		/* To go to Next Digit */
+		number /= 10;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets the brightness of the display.
+ *
+ * Each line is lit for a part of its period, from 0 (off) to LEDMUX_BRIGHTNESS_MAX (the whole period).
+ *
+ * @param level: Brightness level (0 to LEDMUX_BRIGHTNESS_MAX).
+ */
+void LEDMUX_SetBrightness( uint8 level )
+{
+
+	uint8 on_ticks;
+	uint8 off_ticks;
+
+	/* Split the Line Period to the Lit and Dark Parts */
+	MUX_PHASE_Split( LEDMUX_LINE_PERIOD_TICKS , LEDMUX_MIN_PHASE_TICKS , level , LEDMUX_BRIGHTNESS_MAX , & on_ticks , & off_ticks );
+
+	/* Update Both Parts Together for the Interrupt */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	LEDMUX_Phase.OnTicks  = on_ticks;
+	LEDMUX_Phase.OffTicks = off_ticks;
+
+	SREG = sreg;
+}
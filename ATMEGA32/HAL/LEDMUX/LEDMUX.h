@@ -0,0 +1,133 @@
+/****************************************************************************
+ * @file    LEDMUX.h
+ * @author  Boles Medhat
+ * @brief   LED Multiplexer Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This driver refreshes a multiplexed LED display through two chained 74HC595 shift
+ * registers driven by the Shift driver: an 8-digit 7-segment display or an 8x8 LED matrix.
+ * A timer compare match interrupt shifts one line (digit or row) per tick from a display
+ * buffer, so the application only updates the buffer.
+ *
+ * The LEDMUX driver includes the following functionalities:
+ * - Background refresh of up to 8 lines from a timer interrupt, one line per tick.
+ * - 7-segment digits, numbers, decimal points and raw segment patterns.
+ * - LED matrix pixels and rows.
+ * - Brightness control.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the refresh timer in CTC mode with the compare match
+ * 				   interrupt enabled (unless LEDMUX_TIMER_MANUAL), and the SPI (with
+ *	 	 	 	   SHIFT_INTERFACE_SPI), **before** calling LEDMUX_Init(). This driver does not
+ *	 	 	 	   initialize them internally.
+ * - Two chained 74HC595 are used: the first one (next to the MCU) drives the data lines
+ *   (segments or columns) and the second one drives the select lines (digits or rows).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LEDMUX_H_
+#define LEDMUX_H_
+
+#include "LEDMUX_config.h"
+
+
+/*
+ * @brief Initializes the LED multiplexer and starts refreshing the display.
+ *
+ * This function initializes the shift register pins, clears the display buffer,
+ * sets the full brightness and sets the timer compare match callback.
+ */
+void LEDMUX_Init( void );
+
+
+/*
+ * @brief Turns off all the LEDs of the display buffer.
+ */
+void LEDMUX_Clear( void );
+
+
+/*
+ * @brief Writes the LEDs of one line (raw segment pattern or matrix row).
+ *
+ * @param line:    Line number (0 to LEDMUX_LINES_NUM - 1).
+ * @param pattern: Lit LEDs (bit n set lights data line n, for a digit bit 0 to 6 are
+ *                 segments A to G and bit 7 is the decimal point).
+ */
+void LEDMUX_SetLine( uint8 line , uint8 pattern );
+
+
+/*
+ * @brief Turns one LED of an LED matrix on or off.
+ *
+ * @param row:    Row (select line) of the LED (0 to LEDMUX_LINES_NUM - 1).
+ * @param col:    Column (data line) of the LED (0 to 7).
+ * @param status: true to light the LED, false to turn it off.
+ */
+void LEDMUX_SetPixel( uint8 row , uint8 col , uint8 status );
+
+
+/*
+ * @brief Shows a digit (0 to 9) at a position of a 7-segment display.
+ *
+ * The decimal point of the position does not change.
+ *
+ * @param position: Digit position (0 is the digit on select line 0).
+ * @param digit:    Digit to display (0 to 9).
+ */
+void LEDMUX_SetDigit( uint8 position , uint8 digit );
+
+
+/*
+ * @brief Turns the decimal point of a position of a 7-segment display on or off.
+ *
+ * @param position: Digit position (0 is the digit on select line 0).
+ * @param status:   true to light the decimal point, false to turn it off.
+ */
+void LEDMUX_SetDot( uint8 position , uint8 status );
+
+
+/*
+ * @brief Shows a number on a 7-segment display.
+ *
+ * The last position shows the units and position 0 the highest digit, with leading zeros.
+ * The decimal points do not change.
+ *
+ * @param number: The numeric value to be displayed.
+ */
+void LEDMUX_SetNumber( uint32 number );
+
+
+/*
+ * @brief Sets the brightness of the display.
+ *
+ * Each line is lit for a part of its period, from 0 (off) to LEDMUX_BRIGHTNESS_MAX (the whole period).
+ *
+ * @param level: Brightness level (0 to LEDMUX_BRIGHTNESS_MAX).
+ */
+void LEDMUX_SetBrightness( uint8 level );
+
+
+/*
+ * @brief Refreshes the display by one part of a line period.
+ *
+ * Each line period starts by shifting the next line with its LEDs for its lit part, then
+ * all the lines are dark for its dark part (the brightness, see MUX_PHASE). With
+ * LEDMUX_TIMER0 or 2 the driver calls this function from the timer interrupt. With
+ * LEDMUX_TIMER_MANUAL call it from your own timer compare interrupt and load the returned
+ * length minus 1 to the compare value (at full brightness a fixed periodic interrupt also
+ * works, one line per call).
+ *
+ * @return Length of the part that starts, in timer ticks.
+ */
+uint8 LEDMUX_Tick( void );
+
+
+#endif /* LEDMUX_H_ */
@@ -0,0 +1,214 @@
+/****************************************************************************
+ * @file    LEDMUX_config.h
+ * @author  Boles Medhat
+ * @brief   LED Multiplexer Configuration Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains configuration options for the LED multiplexer driver.
+ * It sets the number of lines, the active level of the data and select lines,
+ * the refresh timer and the period of each line.
+ *
+ * @note
+ * - All available choices are defined in `LEDMUX_def.h` and explained with comments there.
+ * - The shift register pins are set in `Shift_config.h`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LEDMUX_CONFIG_H_
+#define LEDMUX_CONFIG_H_
+
+#include "LEDMUX_def.h"
+#include "../ShiftRegister/Shift.h"
+
+
+/*Set the Number of Lines (valid range: 1 - 8)
+ * The digits of a 7-segment display or the rows of an LED matrix
+ */
+#define LEDMUX_LINES_NUM					8
+
+
+/*Set the Active Level of the Data Lines (segments or columns)
+ * choose between:
+ * 1. LEDMUX_ACTIVE_HIGH					<--the most used (common cathode segments, matrix columns to the anodes)
+ * 2. LEDMUX_ACTIVE_LOW
+ */
+#define LEDMUX_DATA_LEVEL					LEDMUX_ACTIVE_HIGH
+
+
+/*Set the Active Level of the Select Lines (digits or rows)
+ * choose between:
+ * 1. LEDMUX_ACTIVE_HIGH					(through a transistor or driver that inverts)
+ * 2. LEDMUX_ACTIVE_LOW						<--the most used (common cathode digits, matrix rows to the cathodes)
+ */
+#define LEDMUX_SELECT_LEVEL					LEDMUX_ACTIVE_LOW
+
+
+/*Set the Timer that Refreshes the Display
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled,
+ * the driver sets the compare value
+ * choose between:
+ * 1. LEDMUX_TIMER_MANUAL					(call LEDMUX_Tick() from your own timer interrupt)
+ * 2. LEDMUX_TIMER0
+ * 3. LEDMUX_TIMER2							<--the most used
+ */
+#define LEDMUX_TIMER						LEDMUX_TIMER2
+
+
+/*Set the Prescaler of your own Timer (used only with LEDMUX_TIMER_MANUAL)
+ * LEDMUX_Tick() returns the length of each part in ticks of this prescaler
+ */
+#define LEDMUX_MANUAL_PRESCALER				64
+
+
+/*Set the Time each Line is Selected in us
+ * Must be between 16 and 255 timer ticks, the brightness is the lit part of this time
+ */
+#define LEDMUX_LINE_PERIOD_US				1000	//<--the most used 1000 (with 8 lines: 125 Hz refresh)
+
+
+
+/* Error checking for invalid configurations */
+#ifndef F_CPU
+	#define F_CPU 8000000UL
+	#warning "F_CPU not defined! Assuming 8MHz."
+#endif
+
+#if ( LEDMUX_LINES_NUM < 1 ) || ( LEDMUX_LINES_NUM > LEDMUX_MAX_LINES )
+	#error "the LEDMUX_LINES_NUM value not in range"
+#endif
+
+#if ( LEDMUX_DATA_LEVEL != LEDMUX_ACTIVE_HIGH ) && ( LEDMUX_DATA_LEVEL != LEDMUX_ACTIVE_LOW )
+	#error "Wrong \"LEDMUX_DATA_LEVEL\" configuration option"
+#endif
+
+#if ( LEDMUX_SELECT_LEVEL != LEDMUX_ACTIVE_HIGH ) && ( LEDMUX_SELECT_LEVEL != LEDMUX_ACTIVE_LOW )
+	#error "Wrong \"LEDMUX_SELECT_LEVEL\" configuration option"
+#endif
+
+/*Register outputs of the dark data and select lines*/
+#define LEDMUX_DATA_OFF						( ( LEDMUX_DATA_LEVEL   == LEDMUX_ACTIVE_HIGH ) ? 0x00 : 0xFF )
+#define LEDMUX_SELECT_OFF					( ( LEDMUX_SELECT_LEVEL == LEDMUX_ACTIVE_HIGH ) ? 0x00 : 0xFF )
+
+/*Shortest on or off time in CPU cycles (longer than the refresh interrupt of the shift interface)*/
+#if SHIFT_INTERFACE == SHIFT_INTERFACE_SPI
+
+	/*SPI clock divider (each of the 16 bits takes this number of CPU cycles)*/
+	#if   SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_2
+		#define LEDMUX_SPI_DIVIDER			2
+	#elif SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_4
+		#define LEDMUX_SPI_DIVIDER			4
+	#elif SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_8
+		#define LEDMUX_SPI_DIVIDER			8
+	#elif SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_16
+		#define LEDMUX_SPI_DIVIDER			16
+	#elif SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_32
+		#define LEDMUX_SPI_DIVIDER			32
+	#elif SPI_CLOCK_RATE == SPI_FREQ_DIVIDED_BY_64
+		#define LEDMUX_SPI_DIVIDER			64
+	#else
+		#define LEDMUX_SPI_DIVIDER			128
+	#endif
+
+	#define LEDMUX_MIN_PHASE_CYCLES			( LEDMUX_ISR_CYCLES + 16 * LEDMUX_SPI_DIVIDER )
+
+#else
+	#define LEDMUX_MIN_PHASE_CYCLES			( LEDMUX_ISR_CYCLES + LEDMUX_DIO_SHIFT_CYCLES )
+
+	/* Use the hardware SPI to keep the interrupt short */
+	#warning "⚠️ Set SHIFT_INTERFACE_SPI, the DIO interface makes each refresh interrupt about 0.2 ms long and limits the brightness levels."
+#endif
+
+#if SHIFT_ORDER != SHIFT_MSB_FIRST
+	#error "LEDMUX needs SHIFT_MSB_FIRST (bit n of a line drives output Qn)"
+#endif
+
+#if   LEDMUX_TIMER == LEDMUX_TIMER0
+
+	#include "../../MCAL/TIMER0/TIMER0.h"
+
+	/* You must initialize Timer0 manually "TIMER0_Init()" before using this driver */
+	#ifndef TIMER0_IN_HAL
+	#define TIMER0_IN_HAL
+		#warning "⚠️ Initialize Timer0 manually before using the LED multiplexer."
+	#endif
+
+	/* Only one driver can use the Timer0 compare match */
+	#ifdef TIMER0_COMP_CLAIMED
+		#error "The Timer0 compare match is used by another driver, change LEDMUX_TIMER"
+	#endif
+	#define TIMER0_COMP_CLAIMED
+
+	/* Configure Timer0 to CTC mode */
+	#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+		#warning "⚠️ Configure Timer0 in CTC mode."
+	#endif
+
+	/* Enable Timer0 compare match interrupt */
+	#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer0 compare match interrupt."
+	#endif
+
+	/*Timer ticks of one line period and of the shortest part*/
+	#define LEDMUX_LINE_PERIOD_TICKS		( ( LEDMUX_LINE_PERIOD_US * ( F_CPU / 1000000UL ) ) / TIMER0_PRESCALER )
+	#define LEDMUX_MIN_PHASE_TICKS			( ( LEDMUX_MIN_PHASE_CYCLES + TIMER0_PRESCALER - 1 ) / TIMER0_PRESCALER )
+
+#elif LEDMUX_TIMER == LEDMUX_TIMER2
+
+	#include "../../MCAL/TIMER2/TIMER2.h"
+
+	/* You must initialize Timer2 manually "TIMER2_Init()" before using this driver */
+	#ifndef TIMER2_IN_HAL
+	#define TIMER2_IN_HAL
+		#warning "⚠️ Initialize Timer2 manually before using the LED multiplexer."
+	#endif
+
+	/* Only one driver can use the Timer2 compare match */
+	#ifdef TIMER2_COMP_CLAIMED
+		#error "The Timer2 compare match is used by another driver, change LEDMUX_TIMER"
+	#endif
+	#define TIMER2_COMP_CLAIMED
+
+	/* Configure Timer2 to CTC mode */
+	#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+		#warning "⚠️ Configure Timer2 in CTC mode."
+	#endif
+
+	/* Enable Timer2 compare match interrupt */
+	#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer2 compare match interrupt."
+	#endif
+
+	/*Timer ticks of one line period and of the shortest part*/
+	#define LEDMUX_LINE_PERIOD_TICKS		( ( LEDMUX_LINE_PERIOD_US * ( F_CPU / 1000000UL ) ) / TIMER2_PRESCALER )
+	#define LEDMUX_MIN_PHASE_TICKS			( ( LEDMUX_MIN_PHASE_CYCLES + TIMER2_PRESCALER - 1 ) / TIMER2_PRESCALER )
+
+#elif LEDMUX_TIMER == LEDMUX_TIMER_MANUAL
+
+	/*Timer ticks of one line period and of the shortest part*/
+	#define LEDMUX_LINE_PERIOD_TICKS		( ( LEDMUX_LINE_PERIOD_US * ( F_CPU / 1000000UL ) ) / LEDMUX_MANUAL_PRESCALER )
+	#define LEDMUX_MIN_PHASE_TICKS			( ( LEDMUX_MIN_PHASE_CYCLES + LEDMUX_MANUAL_PRESCALER - 1 ) / LEDMUX_MANUAL_PRESCALER )
+
+#else
+	#error "Wrong \"LEDMUX_TIMER\" configuration option"
+#endif
+
+/*Check if the line period fits the 8-bit timer*/
+#if ( LEDMUX_LINE_PERIOD_TICKS < 16 ) || ( LEDMUX_LINE_PERIOD_TICKS > 255 )
+	#error "LEDMUX_LINE_PERIOD_US is not between 16 and 255 timer ticks, change it or the timer prescaler"
+#endif
+
+/*Check if the line period holds a lit and a dark part longer than the interrupt*/
+#if LEDMUX_LINE_PERIOD_TICKS < ( 2 * LEDMUX_MIN_PHASE_TICKS )
+	#error "LEDMUX_LINE_PERIOD_US is shorter than two refresh interrupts, increase it or the timer prescaler"
+#endif
+
+
+#endif /* LEDMUX_CONFIG_H_ */
@@ -0,0 +1,64 @@
+/****************************************************************************
+ * @file    LEDMUX_def.h
+ * @author  Boles Medhat
+ * @brief   LED Multiplexer Definitions Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the LED multiplexer driver.
+ *
+ * @note
+ * - These definitions are used in `LEDMUX_config.h` and `LEDMUX.c`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LEDMUX_DEF_H_
+#define LEDMUX_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/MUX_PHASE/MUX_PHASE.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Line Active Levels*/
+#define LEDMUX_ACTIVE_HIGH					0		/*The LED is lit when the register output is HIGH*/
+#define LEDMUX_ACTIVE_LOW					1		/*The LED is lit when the register output is LOW*/
+
+/*Timers that Refresh the Display*/
+#define LEDMUX_TIMER_MANUAL					0		/*LEDMUX_Tick() is called by the user from their own timer interrupt*/
+#define LEDMUX_TIMER0						1		/*Timer0 compare match interrupt refreshes the display*/
+#define LEDMUX_TIMER2						2		/*Timer2 compare match interrupt refreshes the display*/
+
+/*Display Limits*/
+#define LEDMUX_MAX_LINES					8		/*Maximum number of lines (digits or rows)*/
+#define LEDMUX_BRIGHTNESS_MAX				16		/*Full brightness level (0 turns the display off)*/
+#define LEDMUX_ISR_CYCLES					256		/*CPU cycles of the refresh interrupt besides shifting the two bytes*/
+#define LEDMUX_DIO_SHIFT_CYCLES				1536	/*CPU cycles to shift the two bytes with SHIFT_INTERFACE_DIO*/
+
+/*7-Segment Decimal Point Bit*/
+#define LEDMUX_DOT_BIT						7		/*Bit of the decimal point (segment DP) in a digit pattern*/
+
+/*7-Segment Digits Array (0-9), bit 0 to 6 for segments A to G*/
+#define LEDMUX_DIGITS_ARRAY					\
+{0b00111111,			/*0*/				\
+ 0b00000110,			/*1*/				\
+ 0b01011011,			/*2*/				\
+ 0b01001111,			/*3*/				\
+ 0b01100110,			/*4*/				\
+ 0b01101101,			/*5*/				\
+ 0b01111101,			/*6*/				\
+ 0b00000111,			/*7*/				\
+ 0b01111111,			/*8*/				\
+ 0b01101111}			/*9*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* LEDMUX_DEF_H_ */
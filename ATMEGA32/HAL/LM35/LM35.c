@@ -44,12 +44,26 @@
  *         - Celsius    if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_CELSIUS`,
  *         - Fahrenheit if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_FAHRENHEIT`,
  *         - Kelvin     if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_KELVIN`.
+ *         - LM35_NO_TEMPERATURE if the scanned channel has no value yet or is not in ADC_SCAN_CHANNELS (ADC_ISR_SCAN).
  */
 uint16 LM35_getTemperature( void )
 {
 
+	/* Read the ADC Steps of the Sensor */
+	uint16 Steps = LM35_READ_CHANNEL( LM35_CANNEL );
+
+	#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+		/* Check that the Sensor Channel is Scanned and Converted */
+		if( Steps == ADC_SCAN_NO_VALUE )
+		{
+			return LM35_NO_TEMPERATURE;
+		}
+
+	#endif
+
 	/* Convert ADC Steps to Voltage ( 1023 Steps = LM35_VOLT_REF V )*/
-	float32 Volt = ( ADC_Read_10_Bits( LM35_CANNEL ) * LM35_VOLT_REF) / 1023.0;
+	float32 Volt = ( Steps * LM35_VOLT_REF) / 1023.0;
 
 	/* Convert Voltage to Temperature in Celsius (1 V = 100°C for LM35 Sensor)*/
 	uint8 TempInCelsius = Volt * 100;
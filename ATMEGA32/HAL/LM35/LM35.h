@@ -43,6 +43,7 @@
  *         - Celsius    if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_CELSIUS`,
  *         - Fahrenheit if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_FAHRENHEIT`,
  *         - Kelvin     if `LM35_TEMP_UNIT` is `LM35_TEMP_UNIT_KELVIN`.
+ *         - LM35_NO_TEMPERATURE if the scanned channel has no value yet or is not in ADC_SCAN_CHANNELS (ADC_ISR_SCAN).
  */
 uint16 LM35_getTemperature( void );
 
@@ -82,9 +82,23 @@
 #endif
 
 
-/* Enable ADC overflow interrupt */
-#if ADC_INT_STATUS != ADC_INT_DISABLE
-	#warning "⚠️ Disable ADC interrupt."
+/* Read the Cached Value when the ADC Scans the Sensor Channel in the Background (ADC_ISR_SCAN)
+ * LM35_CANNEL must be in ADC_SCAN_CHANNELS and ADC_SCAN_Start() must be called first,
+ * without a scanned value LM35_getTemperature() returns LM35_NO_TEMPERATURE
+ */
+#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+	#define LM35_READ_CHANNEL( channel )			ADC_SCAN_GetValue( channel )
+
+#else
+
+	#define LM35_READ_CHANNEL( channel )			ADC_Read_10_Bits( channel )
+
+	/* Enable ADC overflow interrupt */
+	#if ADC_INT_STATUS != ADC_INT_DISABLE
+		#warning "⚠️ Disable ADC interrupt."
+	#endif
+
 #endif
 
 
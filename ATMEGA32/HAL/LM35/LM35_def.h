@@ -31,6 +31,9 @@
 /*ADC Voltage Reference Value*/
 #define LM35_5V_REF							5		/*Use 5V as ADC reference voltage*/
 #define LM35_2_56V_REF						2.56	/*Use 2.56V as ADC reference voltage*/
+
+/*No Reading*/
+#define LM35_NO_TEMPERATURE					0xFFFF	/*Returned when the scanned sensor channel has no value (ADC_ISR_SCAN)*/
 /*_______________________________________________________________________________________________*/
 
 
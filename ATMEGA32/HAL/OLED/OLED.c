@@ -8,7 +8,7 @@
  *
  * @details
  * This driver provides an abstraction layer for controlling OLED displays
- * based on the SSD1306 controller using I2C communication protocol.
+ * based on the SSD1306 or SH1106 controllers using I2C communication protocol.
  * It includes initialization, command/data transmission, screen control,
  * and basic character printing functionalities.
  *
@@ -28,9 +28,99 @@
 #include "OLED.h"
 
 
+#if OLED_PANELS_MODE == OLED_PANELS_SINGLE
+
 /* Stores the Current Cursor Position on the OLED Display */
 uint8 OLED_CurrentPage = 0 , OLED_CurrentCol = 0;
 
+#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+
+/* Stores the Display RAM Page that is Currently Shown at the Top of the Screen (Console Mode) */
+uint8 OLED_ConsoleTopPage = OLED_FIRST_PAGE;
+
+#endif
+
+#else
+
+/* The Panel Used Until OLED_SelectDisplay is Called (at the Default Address) */
+OLED_Display OLED_DefaultDisplay = { OLED_SLAVE_ADDRESS , OLED_FIRST_PAGE , OLED_FIRST_COL , OLED_FIRST_PAGE };
+
+/* Points to the Panel that All the OLED Functions Use (its Address and Cursor) */
+OLED_Display * OLED_ActiveDisplay = & OLED_DefaultDisplay;
+
+#endif
+
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_SINGLE
+
+/* The Frame Buffer that the Drawing Functions Write into */
+uint8 OLED_FrameBuffer[ OLED_FRAMEBUFFER_SIZE ];
+
+#elif OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_DOUBLE
+
+/* The Two Frame Buffers, one is Drawn (back) while the other is Sent to the Display (front) */
+uint8 OLED_FrameBuffers[ 2 ][ OLED_FRAMEBUFFER_SIZE ];
+
+/* Index of the Back Buffer in OLED_FrameBuffers */
+uint8 OLED_BackBufferIndex = 0;
+
+#endif
+
+
+#if OLED_FRAMEBUFFER_MODE != OLED_FRAMEBUFFER_DISABLE && OLED_MEMORY_MODE == OLED_MEMORY_MODE_HORIZONTAL
+
+/* Commands that Set the Address Window to the Frame Buffer Pages, Followed by the Data Mode Byte */
+static const uint8 OLED_FrameBufferHeader[] = {
+	OLED_COMMAND_CONTINUE , OLED_COLUMN_ADDRESS ,
+	OLED_COMMAND_CONTINUE , OLED_FIRST_COL ,
+	OLED_COMMAND_CONTINUE , OLED_LAST_COL ,
+	OLED_COMMAND_CONTINUE , OLED_PAGE_ADDRESS ,
+	OLED_COMMAND_CONTINUE , OLED_FRAMEBUFFER_FIRST_PAGE ,
+	OLED_COMMAND_CONTINUE , OLED_FRAMEBUFFER_LAST_PAGE ,
+	OLED_DATA_MODE
+};
+
+#elif OLED_FRAMEBUFFER_MODE != OLED_FRAMEBUFFER_DISABLE
+
+/* Commands that Set the Address to the Start of one Frame Buffer Page, Followed by the Data Mode Byte
+ * (page addressing mode does not move to the next page, so the frame buffer is sent page by page) */
+static uint8 OLED_FrameBufferHeader[] = {
+	OLED_COMMAND_CONTINUE , OLED_SET_PAGE_START ,
+	OLED_COMMAND_CONTINUE , OLED_SET_LOW_COLUMN_START | ( OLED_COL_OFFSET & 0x0F ) ,
+	OLED_COMMAND_CONTINUE , OLED_SET_HIGH_COLUMN_START | ( OLED_COL_OFFSET >> 4 ) ,
+	OLED_DATA_MODE
+};
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_DOUBLE
+
+/* Next Front Buffer Page to be Sent (OLED_FRAMEBUFFER_PAGES when all the Pages were Sent) */
+volatile uint8 OLED_FlushPage = OLED_FRAMEBUFFER_PAGES;
+
+/* The Front Buffer being Sent and the Address of the Panel it is Sent to */
+const uint8 * OLED_FlushBuffer = NULL;
+uint8 OLED_FlushAddress = OLED_SLAVE_ADDRESS;
+
+#endif
+
+#endif
+
+
+#if OLED_TILES_MODE == OLED_TILES_ENABLE
+
+/* The Tileset in Program Memory (8 Column Bytes per Tile) */
+const uint8 * OLED_Tileset = NULL;
+
+/* The Tile Index of Each Map Cell */
+uint8 OLED_TileMap[ OLED_TILE_ROWS ][ OLED_TILE_COLS ];
+
+/* One Dirty Bit per Map Cell (bit n of a row is column n), Dirty Tiles are Sent by OLED_TilesFlush */
+uint16 OLED_TileDirty[ OLED_TILE_ROWS ];
+
+/* The Sprites Drawn over the Tile Map */
+OLED_Sprite OLED_Sprites[ OLED_SPRITES_NUM ];
+
+#endif
+
 
 
 
@@ -47,7 +137,7 @@ void OLED_Init( void )
     I2C_Start();
 
     /* Send OLED Slave Address with Write Instruction */
-    I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+    I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 
     /* Disable Display (sleep mode) */
@@ -79,6 +169,8 @@ void OLED_Init( void )
     I2C_WriteOLEDCommand( OLED_DISPLAY_START_LINE | ( OLED_START_ROW_OFFSET & OLED_START_ROW_OFFSET_msk ) );
 
 
+#if OLED_CONTROLLER == OLED_CONTROLLER_SSD1306
+
     /* Configure Charge Pump Mode */
     I2C_WriteOLEDCommand( OLED_CHARGE_PUMP );
 
@@ -92,6 +184,16 @@ void OLED_Init( void )
     /* Set Addressing Mode */
     I2C_WriteOLEDCommand( OLED_MEMORY_MODE );
 
+#else
+
+    /* Configure the SH1106 DC-DC Converter (the SH1106 has no Charge Pump and Uses Page Addressing Only) */
+    I2C_WriteOLEDCommand( OLED_SH1106_SET_DCDC );
+
+    /* Enable the DC-DC Converter */
+    I2C_WriteOLEDCommand( OLED_SH1106_DCDC_ON );
+
+#endif
+
 
     /* Set Segment and COM Output Remapping */
     I2C_WriteOLEDCommand( OLED_SEG_REMAP );
@@ -101,8 +203,8 @@ void OLED_Init( void )
     /* Configure COM pin Hardware */
     I2C_WriteOLEDCommand( OLED_SET_COM_PINS );
 
-    /* Alternative COM pin Configuration */
-    I2C_WriteOLEDCommand( OLED_COM_PINS_ALT );
+    /* COM pin Configuration of the Panel Height */
+    I2C_WriteOLEDCommand( OLED_COM_PINS );
 
 
     /* Set Contrast level */
@@ -146,6 +248,55 @@ void OLED_Init( void )
 
 
 
+#if OLED_PANELS_MODE == OLED_PANELS_MULTIPLE
+
+/*
+ * @brief Prepares the handle of one OLED panel.
+ *
+ * The handle holds the I2C address and the cursor of the panel, so several panels
+ * with different addresses (such as 0x3C and 0x3D) can share the same I2C bus.
+ *
+ * @param display: Pointer to the panel handle.
+ * @param address: The 7-bit I2C address of the panel (OLED_SLAVE_ADDRESS or OLED_SLAVE_ADDRESS_ALT).
+ */
+void OLED_CreateDisplay( OLED_Display * display , uint8 address )
+{
+	/* Store the Panel Address */
+	display->address = address;
+
+	/* Start from the First Page and First Column */
+	display->page    = OLED_FIRST_PAGE;
+	display->col     = OLED_FIRST_COL;
+	display->topPage = OLED_FIRST_PAGE;
+}
+
+
+
+
+
+/*
+ * @brief Selects the OLED panel that all the other OLED functions use.
+ *
+ * The selected handle must remain valid while it is selected. Call `OLED_Init` once
+ * for each panel after selecting it.
+ *
+ * @param display: Pointer to the panel handle (prepared by `OLED_CreateDisplay`).
+ *
+ * @note The frame buffer and the widgets state are not part of the handle, the frame buffer
+ *       is sent to the panel that is selected when `OLED_UpdateScreen` or `OLED_SwapBuffers` is called.
+ */
+void OLED_SelectDisplay( OLED_Display * display )
+{
+	/* All the OLED Functions Use the Address and the Cursor of this Panel */
+	OLED_ActiveDisplay = display;
+}
+
+#endif
+
+
+
+
+
 /*
  * @brief Turns on the OLED display.
  *
@@ -208,96 +359,117 @@ void OLED_LogicInvertDisplay( uint8 invert )
 
 
 /*
- * @brief Sets the cursor position on the OLED display.
+ * @brief Sets the display RAM address pointer without changing the stored cursor position.
  *
- * This function updates the current page and column positions based on the selected
- * memory addressing mode.
+ * This function is not intended for direct use by the user. It is used by `OLED_SetCursor`
+ * and by the functions that write to a region of the display (such as the widgets)
+ * and then restore the text cursor address.
  *
- * @param page:   The target page (row) for the cursor position (valid range: 0 to OLED_TOTAL_PAGES - 1).
- * @param colunm: The target column for the cursor position (valid range: 0 to OLED_TOTAL_COLS - 1).
+ * @param page:   The target page (valid range: 0 to OLED_CURSOR_PAGES - 1).
+ * @param colunm: The target column (valid range: 0 to OLED_TOTAL_COLS - 1).
  */
-void OLED_SetCursor( uint8 page , uint8 colunm )
+static void OLED_SetAddress( uint8 page , uint8 colunm )
 {
 
-	/* Ensure the Specified Position is within Valid Bounds */
-	if( ( page < OLED_TOTAL_PAGES ) && ( colunm < OLED_TOTAL_COLS ) )
-	{
+	/* Check the Configured Memory Addressing Mode */
+	#if		OLED_MEMORY_MODE == OLED_MEMORY_MODE_HORIZONTAL || OLED_MEMORY_MODE == OLED_MEMORY_MODE_VERTICAL
 
-		/* Update Current Cursor Position */
-		OLED_CurrentPage = page;
-		OLED_CurrentCol = colunm;
+		/* Horizontal and Vertical Addressing Modes: Set Page and Column Range */
 
-		/* Check the Configured Memory Addressing Mode */
-		#if		OLED_MEMORY_MODE == OLED_MEMORY_MODE_HORIZONTAL || OLED_MEMORY_MODE == OLED_MEMORY_MODE_VERTICAL
 
-			/* Horizontal and Vertical Addressing Modes: Set Page and Column Range */
+		/* Start I2C Communication */
+		I2C_Start();
 
+		/* Send OLED Slave Address with Write Instruction */
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
-			/* Start I2C Communication */
-			I2C_Start();
+		/* Send Command Mode Byte */
+		I2C_WriteData( OLED_COMMAND_MODE );
 
-			/* Send OLED Slave Address with Write Instruction */
-			I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
 
-			/* Send Command Mode Byte */
-			I2C_WriteData( OLED_COMMAND_MODE );
+		/* Set Column Address Range */
+		I2C_WriteData( OLED_COLUMN_ADDRESS );
 
+		/* From the Target Start Column */
+		I2C_WriteData( colunm );
 
-			/* Set Column Address Range */
-			I2C_WriteData( OLED_COLUMN_ADDRESS );
+		/* To the Last Column in the Display */
+		I2C_WriteData( OLED_LAST_COL );
 
-			/* From the Target Start Column */
-			I2C_WriteData( colunm );
 
-			/* To the Last Column in the Display */
-			I2C_WriteData( OLED_LAST_COL );
+		/* Set Page Address Range */
+		I2C_WriteData( OLED_PAGE_ADDRESS );
 
+		/* From the Target Start Page */
+		I2C_WriteData( page );
 
-			/* Set Page Address Range */
-			I2C_WriteData( OLED_PAGE_ADDRESS );
+		/* To the Last Page the Cursor can Reach */
+		I2C_WriteData( OLED_CURSOR_PAGES - 1 );
 
-			/* From the Target Start Page */
-			I2C_WriteData( page );
 
-			/* To the Last Page in the Display */
-			I2C_WriteData( OLED_LAST_PAGE );
+		/* Stop I2C Communication */
+		I2C_Stop();
 
+	#elif	OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
 
-			/* Stop I2C Communication */
-			I2C_Stop();
+		/* Page Addressing Mode: Set Individual Page and Column Addresses */
 
-		#elif	OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
 
-			/* Page Addressing Mode: Set Individual Page and Column Addresses */
+		/* Add the Controller Column Offset (SH1106), then Extract Lower and Higher Column Address Nibbles */
+		uint8 lowCol = ( colunm + OLED_COL_OFFSET ) & 0x0F;
+		uint8 highCol = ( ( colunm + OLED_COL_OFFSET ) >> 4 ) & 0x0F;
+
+		/* Start I2C Communication */
+		I2C_Start();
+
+		/* Send OLED Slave Address with Write Instruction */
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+		/* Send Command Mode Byte */
+		I2C_WriteData( OLED_COMMAND_MODE );
 
 
-			/* Extract Lower and Higher Column Address Nibbles */
-			uint8 lowCol = colunm & 0x0F;
-			uint8 highCol = ( colunm >> 4 ) & 0x0F;
+		/* Set Page and Column Addresses */
+		I2C_WriteData( OLED_SET_PAGE_START | page );
+		I2C_WriteData( OLED_SET_LOW_COLUMN_START | lowCol );
+		I2C_WriteData( OLED_SET_HIGH_COLUMN_START |  highCol );
 
-			/* Start I2C Communication */
-			I2C_Start();
 
-			/* Send OLED Slave Address with Write Instruction */
-			I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+		/* Stop I2C Communication */
+		I2C_Stop();
 
-			/* Send Command Mode Byte */
-			I2C_WriteData( OLED_COMMAND_MODE );
+	#else
+		/* Make an Error */
+		#error "Wrong \"OLED_MEMORY_MODE\" configuration option"
+	#endif
+}
 
 
-			/* Set Page and Column Addresses */
-			I2C_WriteData( OLED_SET_PAGE_START | page );
-			I2C_WriteData( OLED_SET_LOW_COLUMN_START | lowCol );
-			I2C_WriteData( OLED_SET_HIGH_COLUMN_START |  highCol );
 
 
-			/* Stop I2C Communication */
-			I2C_Stop();
 
-		#else
-			/* Make an Error */
-			#error "Wrong \"OLED_MEMORY_MODE\" configuration option"
-		#endif
+/*
+ * @brief Sets the cursor position on the OLED display.
+ *
+ * This function updates the current page and column positions based on the selected
+ * memory addressing mode.
+ *
+ * @param page:   The target page (row) for the cursor position (valid range: 0 to OLED_CURSOR_PAGES - 1).
+ * @param colunm: The target column for the cursor position (valid range: 0 to OLED_TOTAL_COLS - 1).
+ */
+void OLED_SetCursor( uint8 page , uint8 colunm )
+{
+
+	/* Ensure the Specified Position is within Valid Bounds */
+	if( ( page < OLED_CURSOR_PAGES ) && ( colunm < OLED_TOTAL_COLS ) )
+	{
+
+		/* Update Current Cursor Position */
+		OLED_CURSOR_PAGE = page;
+		OLED_CURSOR_COL = colunm;
+
+		/* Set the Display RAM Address Pointer */
+		OLED_SetAddress( page , colunm );
 	}
 }
 
@@ -310,11 +482,89 @@ void OLED_SetCursor( uint8 page , uint8 colunm )
  *
  * This function increments the current page and resets the column to the first position.
  * If the cursor is on the last page, it wraps around to the first page.
+ *
+ * In console mode (`OLED_CONSOLE_ENABLE`), if the cursor is on the last visible line,
+ * the text is scrolled up one page in hardware by moving the display start line,
+ * and only the newly exposed line is cleared.
  */
 void OLED_GoToNextLine( void )
 {
-	/* Move to the next page (row), wrapping around if at the last page */
-	OLED_SetCursor( ( OLED_CurrentPage + 1 ) % OLED_TOTAL_PAGES , OLED_FIRST_COL );
+
+	/* Get the next page (row), wrapping around if at the last page */
+	uint8 nextPage = ( OLED_CURSOR_PAGE + 1 ) % OLED_CURSOR_PAGES;
+
+
+	#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+
+		/* Check if the Next Page is Below the Screen (the Cursor is on the Last Visible Line) */
+		if( nextPage == ( OLED_CONSOLE_TOP_PAGE + OLED_TOTAL_PAGES ) % OLED_RAM_PAGES )
+		{
+			/* Move the Oldest Line from the Top of the Screen to the Bottom */
+			OLED_CONSOLE_TOP_PAGE = ( OLED_CONSOLE_TOP_PAGE + 1 ) % OLED_RAM_PAGES;
+
+			/* Set the Display Start Line to the New Top Page */
+			OLED_WriteCommand( OLED_DISPLAY_START_LINE | ( ( OLED_CONSOLE_TOP_PAGE * OLED_PAGE_HEIGHT + OLED_START_ROW_OFFSET ) & OLED_START_ROW_OFFSET_msk ) );
+
+			/* Clear the Newly Exposed Line (Leaves the Cursor at its Start) */
+			OLED_ClearPage( nextPage );
+
+			return;
+		}
+
+	#endif
+
+
+	/* Move to the next page (row) */
+	OLED_SetCursor( nextPage , OLED_FIRST_COL );
+}
+
+
+
+
+
+/*
+ * @brief Clears a single page (8 rows) of the OLED display.
+ *
+ * This function writes zeros to all the columns of the specified page
+ * and then leaves the cursor at the start of that page.
+ *
+ * @param page: The page to be cleared (valid range: 0 to OLED_CURSOR_PAGES - 1).
+ */
+void OLED_ClearPage( uint8 page )
+{
+
+	/* Ensure the Specified Page is within Valid Bounds */
+	if( page < OLED_CURSOR_PAGES )
+	{
+
+		/* Set Cursor to the First Column of the Page */
+		OLED_SetCursor( page , OLED_FIRST_COL );
+
+
+		/* Start I2C Communication */
+		I2C_Start();
+
+		/* Send OLED Slave Address with Write Instruction */
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+		/* Set OLED to Data Mode for Writing Pixel Data */
+		I2C_WriteData( OLED_DATA_MODE );
+
+
+		/* Write Zeros to All the Columns of the Page */
+		for( uint8 col = 0 ; col < OLED_TOTAL_COLS ; col++ )
+		{
+			I2C_WriteData( 0x00 );
+		}
+
+
+		/* Stop I2C Communication */
+		I2C_Stop();
+
+
+		/* Return the Cursor to the Start of the Cleared Page */
+		OLED_SetCursor( page , OLED_FIRST_COL );
+	}
 }
 
 
@@ -334,6 +584,30 @@ void OLED_ClearScreen( void )
 	OLED_DisplayOFF();
 
 
+	#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+
+		/* Reset the Console to Show the First Page at the Top of the Screen */
+		OLED_CONSOLE_TOP_PAGE = OLED_FIRST_PAGE;
+
+		/* Restore the Configured Display Start Line */
+		OLED_WriteCommand( OLED_DISPLAY_START_LINE | ( OLED_START_ROW_OFFSET & OLED_START_ROW_OFFSET_msk ) );
+
+	#endif
+
+
+#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
+
+	/* Page Addressing Mode does not Move to the Next Page, so Clear the Pages One by One */
+	for( uint8 page = OLED_FIRST_PAGE ; page < OLED_CURSOR_PAGES ; page++ )
+	{
+		OLED_ClearPage( page );
+	}
+
+	/* Set Cursor to the First Page and First Column */
+	OLED_SetCursor( OLED_FIRST_PAGE , OLED_FIRST_COL );
+
+#else
+
 	/* Set Cursor to the First Page and First Column */
 	OLED_SetCursor( OLED_FIRST_PAGE , OLED_FIRST_COL );
 
@@ -342,14 +616,14 @@ void OLED_ClearScreen( void )
 	I2C_Start();
 
 	/* Send OLED Slave Address with Write Instruction */
-	I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+	I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 	/* Set OLED to Data Mode for Writing Pixel Data */
 	I2C_WriteData( OLED_DATA_MODE );
 
 
-	/* Write Zeros to All Display Memory (Clear All Pixels) */
-	for( uint16 byte = 0 ; byte < OLED_TOTAL_BYTES ; byte++ )
+	/* Write Zeros to All Display Memory the Cursor can Reach (Clear All Pixels) */
+	for( uint16 byte = 0 ; byte < OLED_CURSOR_PAGES * OLED_TOTAL_COLS ; byte++ )
 	{
 		I2C_WriteData( 0x00 );
 	}
@@ -358,6 +632,8 @@ void OLED_ClearScreen( void )
 	/* Stop I2C Communication */
 	I2C_Stop();
 
+#endif
+
 
 	/* Turn the Display Back On After Clearing */
 	OLED_DisplayON();
@@ -367,6 +643,8 @@ void OLED_ClearScreen( void )
 
 
 
+#if OLED_CONTROLLER == OLED_CONTROLLER_SSD1306
+
 /*
  * @brief Deactivates any active scrolling on the OLED display.
  *
@@ -425,7 +703,7 @@ void OLED_ScrollHorizontal( uint8 direction , uint8 start_page , uint8 end_page
 		I2C_Start();
 
 		/* Send OLED Slave Address with Write Instruction */
-		I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 		/* Send Command Mode Byte */
 		I2C_WriteData( OLED_COMMAND_MODE );
@@ -519,7 +797,7 @@ void OLED_Scroll( uint8 direction , uint8 start_page, uint8 end_page, uint8 scro
 		I2C_Start();
 
 		/* Send OLED Slave Address with Write Instruction */
-		I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 		/* Send Command Mode Byte */
 		I2C_WriteData( OLED_COMMAND_MODE );
@@ -571,6 +849,8 @@ void OLED_Scroll( uint8 direction , uint8 start_page, uint8 end_page, uint8 scro
 	}
 }
 
+#endif
+
 
 
 
@@ -612,7 +892,7 @@ void OLED_WriteCommand( uint8 command )
 	I2C_Start();
 
 	/* Send OLED Slave Address with Write Instruction */
-	I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+	I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 	/* Send Command Mode Byte */
 	I2C_WriteData( OLED_COMMAND_MODE );
@@ -628,6 +908,55 @@ void OLED_WriteCommand( uint8 command )
 
 
 
+/*
+ * @brief Writes the font columns of a single character followed by its spacing byte.
+ *
+ * This function is not intended for direct use by the user. It must be called
+ * within an active I2C data transaction (after `OLED_DATA_MODE` has been sent),
+ * so several characters can be streamed in the same transaction. It updates the
+ * cursor column according to the bytes written.
+ *
+ * @param character: The ASCII character to be written (must exist in the font table).
+ */
+static void OLED_WriteCharacterColumns( uint8 character )
+{
+
+	/* Variable to Store the Current Column Byte of the Character From the Font Table */
+	uint8 charColByte;
+
+	/* Adjust character index to match the font table */
+	character -= 0x20;
+
+
+	/* Write Font Data (Character) Column by Column */
+	for(uint8 colIndex = 0 ; colIndex < OLED_FONT_SIZE ; colIndex++ )
+	{
+		/* Read Font Data from PROGMEM (flash memory) */
+		charColByte = pgm_read_byte( & FontTable[ character ][ colIndex ] );
+
+		/* Send Character Column Data */
+		I2C_WriteData( charColByte );
+	}
+
+
+	/* Update the Cursor Position */
+	OLED_CURSOR_COL += OLED_FONT_SIZE;
+
+	/* Add a Space After the Character if there's Room */
+	if( OLED_CURSOR_COL != OLED_LAST_COL )
+	{
+		/* Print Space */
+		I2C_WriteData( OLED_SPACE_BYTE );
+
+		/* Update the Cursor Position */
+		OLED_CURSOR_COL++;
+	}
+}
+
+
+
+
+
 /*
  * @brief Prints a single character on the OLED display at the current cursor position.
  *
@@ -641,55 +970,27 @@ void OLED_PrintCharacter( uint8 character )
 {
 
 	/* Move to the Next line if there's not enough Space or if the Character is a Newline */
-	if ( ( ( OLED_CurrentCol + OLED_FONT_SIZE ) > OLED_LAST_COL ) || ( character == '\n' ) )
+	if ( ( ( OLED_CURSOR_COL + OLED_FONT_SIZE ) > OLED_LAST_COL ) || ( character == '\n' ) )
 	{
 		OLED_GoToNextLine();
 	}
 
 	/* Validate that the Character is in the Font Table Before Printing and not Newline Character */
-	if ( ( character != '\n' ) && ( character > 0x19 ) && ( ( character - 0x20 ) < ( FontTableSize / OLED_FONT_SIZE ) ) )
+	if ( OLED_IS_PRINTABLE( character ) )
 	{
 
-		/* Variable to Store the Current Column Byte of the Character From the Font Table */
-		uint8 charColByte;
-
-		/* Adjust character index to match the font table */
-		character -= 0x20;
-
-
 		/* Start I2C Communication */
 		I2C_Start();
 
 		/* Send OLED Slave Address with Write Instruction */
-		I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 		/* Set OLED to Data Mode for Writing Pixel Data */
 		I2C_WriteData( OLED_DATA_MODE );
 
 
-		/* Write Font Data (Character) Column by Column */
-		for(uint8 colIndex = 0 ; colIndex < OLED_FONT_SIZE ; colIndex++ )
-		{
-			/* Read Font Data from PROGMEM (flash memory) */
-			charColByte = pgm_read_byte( & FontTable[ character ][ colIndex ] );
-
-			/* Send Character Column Data */
-			I2C_WriteData( charColByte );
-		}
-
-
-		/* Update the Cursor Position */
-		OLED_CurrentCol += OLED_FONT_SIZE;
-
-		/* Add a Space After the Character if there's Room */
-		if( OLED_CurrentCol != OLED_LAST_COL )
-		{
-			/* Print Space */
-			I2C_WriteData( OLED_SPACE_BYTE );
-
-			/* Update the Cursor Position */
-			OLED_CurrentCol++;
-		}
+		/* Write the Character Columns and its Spacing Byte */
+		OLED_WriteCharacterColumns( character );
 
 
 		/* Stop I2C Communication */
@@ -704,18 +1005,74 @@ void OLED_PrintCharacter( uint8 character )
 /*
  * @brief Prints a null-terminated string on the OLED display.
  *
- * This function iterates through each character in the provided string
- * and prints.
+ * This function streams the font columns and spacing bytes of all the characters
+ * that fit in the current line within a single I2C data transaction, instead of
+ * one transaction per character. When the line is full or a '\n' is found, the
+ * transaction is closed, the address window is moved to the next line and a new
+ * transaction is started for the rest of the string.
  *
  * @param Str: Pointer to the null-terminated string to be displayed.
  */
 void OLED_PrintString( const char * Str )
 {
+
+	/* Flag to Track if there is an Open I2C Data Transaction */
+	uint8 isTransferActive = false;
+
+	/* Variable to Store the Current Character of the String */
+	uint8 character;
+
+
 	/*  Loop through each Character of the String Until the NULL Character is found */
 	for(uint8 CharacterIndex = 0 ; Str[CharacterIndex] != '\0' ; CharacterIndex++)
 	{
-		/* Print each Character on the OLED */
-		OLED_PrintCharacter( (uint8) Str[CharacterIndex] );
+		character = (uint8) Str[CharacterIndex];
+
+		/* Move to the Next line if there's not enough Space or if the Character is a Newline */
+		if ( ( ( OLED_CURSOR_COL + OLED_FONT_SIZE ) > OLED_LAST_COL ) || ( character == '\n' ) )
+		{
+			/* Close the Current Data Transaction Before Sending the Address Window Commands */
+			if( isTransferActive == true )
+			{
+				/* Stop I2C Communication */
+				I2C_Stop();
+
+				isTransferActive = false;
+			}
+
+			/* Re-window the Display RAM to the Start of the Next Line */
+			OLED_GoToNextLine();
+		}
+
+		/* Validate that the Character is in the Font Table Before Printing and not Newline Character */
+		if ( OLED_IS_PRINTABLE( character ) )
+		{
+			/* Open a Data Transaction Only Once per Line */
+			if( isTransferActive == false )
+			{
+				/* Start I2C Communication */
+				I2C_Start();
+
+				/* Send OLED Slave Address with Write Instruction */
+				I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+				/* Set OLED to Data Mode for Writing Pixel Data */
+				I2C_WriteData( OLED_DATA_MODE );
+
+				isTransferActive = true;
+			}
+
+			/* Stream the Character Columns and its Spacing Byte */
+			OLED_WriteCharacterColumns( character );
+		}
+	}
+
+
+	/* Close the Last Data Transaction */
+	if( isTransferActive == true )
+	{
+		/* Stop I2C Communication */
+		I2C_Stop();
 	}
 }
 
@@ -745,7 +1102,7 @@ void OLED_PrintNumber( sint32 Number )
 	}
 
 	/* Check if it its in the Current line, otherwise Move to the Next line */
-	if( ( length * ( OLED_FONT_SIZE + 1 ) + OLED_CurrentCol ) > OLED_LAST_COL )
+	if( ( length * ( OLED_FONT_SIZE + 1 ) + OLED_CURSOR_COL ) > OLED_LAST_COL )
 	{
 		OLED_GoToNextLine();
 	}
@@ -773,7 +1130,7 @@ void OLED_PrintByte( uint8 byte )
 	I2C_Start();
 
 	/* Send OLED Slave Address with Write Instruction */
-	I2C_SendSlaveAddress_Write( OLED_SLAVE_ADDRESS );
+	I2C_SendSlaveAddress_Write( OLED_ADDRESS );
 
 	/* Set OLED to Data Mode for Writing Pixel Data */
 	I2C_WriteData( OLED_DATA_MODE );
@@ -790,16 +1147,29 @@ void OLED_PrintByte( uint8 byte )
 
 
 /*
- * @brief Retrieves the current page position of the cursor on the OLED display.
+ * @brief Starts an I2C data transaction at a display RAM position without moving the text cursor.
  *
- * This function returns the current page where the cursor is positioned.
+ * This function is not intended for direct use by the user. It sets the display RAM address,
+ * then starts the I2C communication in data mode. The caller sends the data bytes
+ * with `I2C_WriteData` and ends the transaction with `I2C_Stop`.
  *
- * @return: The current page position (0-7).
+ * @param page: The target page.
+ * @param col:  The target column.
  */
-uint8 OLED_GetPage( void )
+static void OLED_BeginData( uint8 page , uint8 col )
 {
-	/* Returns the Current Page Position of the Cursor on the OLED Display */
-	return OLED_CurrentPage;
+
+	/* Set the Display RAM Address Pointer */
+	OLED_SetAddress( page , col );
+
+	/* Start I2C Communication */
+	I2C_Start();
+
+	/* Send OLED Slave Address with Write Instruction */
+	I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+	/* Set OLED to Data Mode for Writing Pixel Data */
+	I2C_WriteData( OLED_DATA_MODE );
 }
 
 
@@ -807,16 +1177,1502 @@ uint8 OLED_GetPage( void )
 
 
 /*
- * @brief Retrieves the current column position of the cursor on the OLED display.
+ * @brief Scales a widget value to a number of columns or rows.
  *
- * This function returns the current column where the cursor is positioned.
+ * This function is not intended for direct use by the user. It maps the value from
+ * the range (min to max) to the range (0 to range) using 32-bit math, clamping
+ * values outside the range.
  *
- * @return: The current column position (0-127).
+ * @param value: The value to be scaled.
+ * @param min:   The value mapped to 0.
+ * @param max:   The value mapped to `range`.
+ * @param range: The highest scaled value.
+ *
+ * @return: The scaled value (0 to range).
  */
-uint8 OLED_GetColumn( void )
+static uint8 OLED_WidgetScale( sint16 value , sint16 min , sint16 max , uint8 range )
 {
-	/* Returns the Current Column Position of the Cursor on the OLED Display */
-	return OLED_CurrentCol;
-}
+
+	/* Clamp the Values Outside the Range */
+	if( value <= min )
+	{
+		return 0;
+	}
+	else if( value >= max )
+	{
+		return range;
+	}
+	else
+	{
+		return (uint8) ( ( ( (sint32) value - min ) * range ) / ( (sint32) max - min ) );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Calculates the byte of a widget page that has a vertical span of pixels turned on.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param pageIndex: The page index inside the widget (0 is the top page of the widget).
+ * @param top:       The first row of the span, counted from the widget top.
+ * @param bottom:    The last row of the span, counted from the widget top.
+ *
+ * @return: The column byte of the page (LSB is the top pixel).
+ */
+static uint8 OLED_WidgetSpanByte( uint8 pageIndex , uint8 top , uint8 bottom )
+{
+
+	/* Get the First and Last Rows of the Page */
+	uint8 firstRow = pageIndex * OLED_PAGE_HEIGHT;
+	uint8 lastRow  = firstRow + OLED_PAGE_HEIGHT - 1;
+
+	/* Check if the Span is Outside the Page */
+	if( ( bottom < firstRow ) || ( top > lastRow ) )
+	{
+		return 0x00;
+	}
+
+	/* Clip the Span to the Page */
+	if( top < firstRow )
+	{
+		top = firstRow;
+	}
+
+	if( bottom > lastRow )
+	{
+		bottom = lastRow;
+	}
+
+	/* Turn On the Bits from the Span Top to the Span Bottom */
+	return (uint8) ( 0xFF << ( top - firstRow ) ) & (uint8) ( 0xFF >> ( lastRow - bottom ) );
+}
+
+
+
+
+
+/*
+ * @brief Gets the sample drawn in a sparkline column.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param chart: Pointer to the chart structure.
+ * @param col:   The column index inside the chart.
+ *
+ * @return: The scaled sample (rows from the chart bottom).
+ */
+static uint8 OLED_SparklineSample( OLED_Sparkline * chart , uint8 col )
+{
+
+	/* Get the Ring Buffer Index of the Column Sample Without Division */
+	uint8 index = chart->head + col;
+
+	if( index >= chart->width )
+	{
+		index -= chart->width;
+	}
+
+	return chart->samples[ index ];
+}
+
+
+
+
+
+/*
+ * @brief Gets the rows spanned by a sparkline column (from the previous sample to its sample).
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param chart: Pointer to the chart structure.
+ * @param col:   The column index inside the chart.
+ *
+ * @return: The span as ( low row << 8 ) | high row, rows counted from the chart bottom.
+ */
+static uint16 OLED_SparklineSpan( OLED_Sparkline * chart , uint8 col )
+{
+
+	/* Get the Column Sample */
+	uint8 current = OLED_SparklineSample( chart , col );
+
+	/* The First Column has no Previous Sample */
+	uint8 previous = ( col > 0 ) ? OLED_SparklineSample( chart , col - 1 ) : current;
+
+	return OLED_SPARKLINE_SPAN( previous , current );
+}
+
+
+
+
+
+/*
+ * @brief Draws a run of neighboring sparkline columns.
+ *
+ * This function is not intended for direct use by the user. It sends the run
+ * in a single I2C data transaction per chart page.
+ *
+ * @param chart: Pointer to the chart structure.
+ * @param first: The first column index of the run inside the chart.
+ * @param last:  The last column index of the run inside the chart.
+ */
+static void OLED_SparklineDrawColumns( OLED_Sparkline * chart , uint8 first , uint8 last )
+{
+
+	/* Get the Bottom Row of the Chart, Counted from the Chart Top */
+	uint8 bottomRow = chart->pages * OLED_PAGE_HEIGHT - 1;
+
+	uint16 span;
+
+	for( uint8 pageIndex = 0 ; pageIndex < chart->pages ; pageIndex++ )
+	{
+		/* Start a Data Transaction at the First Column of the Run */
+		OLED_BeginData( chart->page + pageIndex , chart->col + first );
+
+		for( uint8 col = first ; col <= last ; col++ )
+		{
+			/* Get the Column Span and Convert it to Rows Counted from the Chart Top */
+			span = OLED_SparklineSpan( chart , col );
+
+			I2C_WriteData( OLED_WidgetSpanByte( pageIndex , bottomRow - (uint8) span , bottomRow - (uint8) ( span >> 8 ) ) );
+		}
+
+		/* Stop I2C Communication */
+		I2C_Stop();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Draws a region of a bar graph.
+ *
+ * This function is not intended for direct use by the user. It sends the region
+ * in a single I2C data transaction per page.
+ *
+ * @param bar:       Pointer to the bar structure.
+ * @param firstPage: The first page index of the region inside the bar.
+ * @param lastPage:  The last page index of the region inside the bar.
+ * @param firstCol:  The first column index of the region inside the bar.
+ * @param lastCol:   The last column index of the region inside the bar.
+ */
+static void OLED_BarDrawRegion( OLED_Bar * bar , uint8 firstPage , uint8 lastPage , uint8 firstCol , uint8 lastCol )
+{
+
+	/* Get the Bottom Row of the Bar, Counted from the Bar Top */
+	uint8 bottomRow = bar->pages * OLED_PAGE_HEIGHT - 1;
+
+	uint8 byte;
+
+	for( uint8 pageIndex = firstPage ; pageIndex <= lastPage ; pageIndex++ )
+	{
+		/* Start a Data Transaction at the First Column of the Region */
+		OLED_BeginData( bar->page + pageIndex , bar->col + firstCol );
+
+		for( uint8 col = firstCol ; col <= lastCol ; col++ )
+		{
+			if( bar->direction == OLED_BAR_HORIZONTAL )
+			{
+				if( col < bar->level )
+				{
+					/* Filled Column */
+					byte = OLED_BAR_FILLED_BYTE;
+				}
+				else
+				{
+					/* Empty Column, Only the Top and Bottom Borders */
+					byte = ( ( pageIndex == 0 ) ? OLED_BAR_TOP_BORDER_BYTE : 0x00 ) | ( ( pageIndex == bar->pages - 1 ) ? OLED_BAR_BOTTOM_BORDER_BYTE : 0x00 );
+				}
+			}
+			else
+			{
+				if( ( col == 0 ) || ( col == bar->width - 1 ) )
+				{
+					/* Left and Right Borders */
+					byte = OLED_BAR_BORDER_BYTE;
+				}
+				else if( bar->level > 0 )
+				{
+					/* Filled Rows from the Bottom */
+					byte = OLED_WidgetSpanByte( pageIndex , bottomRow + 1 - bar->level , bottomRow );
+				}
+				else
+				{
+					/* Empty Column */
+					byte = 0x00;
+				}
+			}
+
+			I2C_WriteData( byte );
+		}
+
+		/* Stop I2C Communication */
+		I2C_Stop();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Draws a list of gauge columns, drawing each column only once.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param gauge:   Pointer to the gauge structure.
+ * @param columns: The column indices inside the gauge (OLED_GAUGE_NO_MARKER entries are skipped).
+ * @param count:   The number of columns in the list.
+ */
+static void OLED_GaugeDrawColumns( OLED_Gauge * gauge , uint8 * columns , uint8 count )
+{
+
+	uint8 byte;
+
+	for( uint8 index = 0 ; index < count ; index++ )
+	{
+
+		/* Skip Empty Entries */
+		if( columns[ index ] == OLED_GAUGE_NO_MARKER )
+		{
+			continue;
+		}
+
+		/* Skip Columns that Appear Again Later in the List */
+		uint8 isRepeated = false;
+
+		for( uint8 next = index + 1 ; next < count ; next++ )
+		{
+			if( columns[ next ] == columns[ index ] )
+			{
+				isRepeated = true;
+			}
+		}
+
+		if( isRepeated == true )
+		{
+			continue;
+		}
+
+
+		/* Build the Column Byte from the Scale, the Pointer and the Markers */
+		byte = OLED_GAUGE_SCALE_BYTE;
+
+		if( columns[ index ] == gauge->position )
+		{
+			byte |= OLED_GAUGE_POINTER_BYTE;
+		}
+
+		if( ( columns[ index ] == gauge->minMarker ) || ( columns[ index ] == gauge->maxMarker ) )
+		{
+			byte |= OLED_GAUGE_MARKER_BYTE;
+		}
+
+
+		/* Send the Column Byte */
+		OLED_BeginData( gauge->page , gauge->col + columns[ index ] );
+
+		I2C_WriteData( byte );
+
+		I2C_Stop();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initializes a scrolling sparkline chart and draws it empty.
+ *
+ * The chart keeps one sample per column in a ring buffer. Each column is drawn as a
+ * vertical line from the previous sample to its sample, so the samples look connected.
+ *
+ * @param chart:   Pointer to the chart structure.
+ * @param samples: Ring buffer that holds `width` samples (must remain valid while the chart is used).
+ * @param page:    The first (top) page of the chart.
+ * @param col:     The first (left) column of the chart.
+ * @param width:   The number of columns (and samples) of the chart.
+ * @param pages:   The number of pages (height / 8) of the chart.
+ * @param min:     The sample value drawn at the chart bottom.
+ * @param max:     The sample value drawn at the chart top.
+ *
+ * @note If the chart does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_SparklineInit( OLED_Sparkline * chart , uint8 * samples , uint8 page , uint8 col , uint8 width , uint8 pages , sint16 min , sint16 max )
+{
+
+	/* Ensure the Chart Fits in the Display */
+	if( ( width == 0 ) || ( pages == 0 ) || ( ( col + width ) > OLED_TOTAL_COLS ) || ( ( page + pages ) > OLED_TOTAL_PAGES ) )
+	{
+		/* Mark the Chart as Invalid */
+		chart->width = 0;
+		return;
+	}
+
+
+	/* Store the Chart Data */
+	chart->samples = samples;
+	chart->min     = min;
+	chart->max     = max;
+	chart->page    = page;
+	chart->col     = col;
+	chart->width   = width;
+	chart->pages   = pages;
+	chart->head    = 0;
+
+	/* Fill the Ring Buffer with Samples at the Chart Bottom */
+	for( uint8 index = 0 ; index < width ; index++ )
+	{
+		samples[ index ] = 0;
+	}
+
+
+	/* Draw All the Chart Columns */
+	OLED_SparklineDrawColumns( chart , 0 , width - 1 );
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Adds a sample to a sparkline chart, shifting it one column to the left.
+ *
+ * The oldest sample is dropped and the new sample is drawn in the right column.
+ * Only the columns whose drawing changed after the shift are sent to the display,
+ * grouping neighboring columns in a single I2C data transaction per page.
+ *
+ * @param chart: Pointer to the chart structure.
+ * @param value: The new sample value (clamped to the chart range).
+ */
+void OLED_SparklineAddSample( OLED_Sparkline * chart , sint16 value )
+{
+
+	/* Ignore Invalid Charts */
+	if( chart->width == 0 )
+	{
+		return;
+	}
+
+
+	/* Save the Oldest Sample, it is Needed to Know the Old Drawing of the Left Columns */
+	uint8 dropped = chart->samples[ chart->head ];
+
+	/* Replace the Oldest Sample with the New Sample, then Shift the Chart One Column */
+	chart->samples[ chart->head ] = OLED_WidgetScale( value , chart->min , chart->max , chart->pages * OLED_PAGE_HEIGHT - 1 );
+	chart->head = ( chart->head + 1 < chart->width ) ? chart->head + 1 : 0;
+
+
+	/* Start of the Current Run of Changed Columns (OLED_GAUGE_NO_MARKER if no run) */
+	uint8 runStart = OLED_GAUGE_NO_MARKER;
+
+	/* Samples Drawn in the Current Column and the Column Before it, Before the Shift */
+	uint8 oldPrev = dropped , oldCurr = dropped;
+
+	for( uint8 col = 0 ; col < chart->width ; col++ )
+	{
+
+		/* Old Drawing of this Column: Column 0 was the Dropped Sample, Column 1 Connected it with the Sample Now in Column 0 */
+		if( col > 0 )
+		{
+			oldPrev = oldCurr;
+			oldCurr = OLED_SparklineSample( chart , col - 1 );
+		}
+
+		/* Check if the Drawing of this Column Changed */
+		if( OLED_SparklineSpan( chart , col ) != OLED_SPARKLINE_SPAN( oldPrev , oldCurr ) )
+		{
+			/* Start a New Run of Changed Columns */
+			if( runStart == OLED_GAUGE_NO_MARKER )
+			{
+				runStart = col;
+			}
+		}
+		else if( runStart != OLED_GAUGE_NO_MARKER )
+		{
+			/* Draw the Ended Run of Changed Columns */
+			OLED_SparklineDrawColumns( chart , runStart , col - 1 );
+
+			runStart = OLED_GAUGE_NO_MARKER;
+		}
+	}
+
+	/* Draw the Last Run of Changed Columns */
+	if( runStart != OLED_GAUGE_NO_MARKER )
+	{
+		OLED_SparklineDrawColumns( chart , runStart , chart->width - 1 );
+	}
+
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Initializes a horizontal or vertical bar graph and draws it empty.
+ *
+ * @param bar:       Pointer to the bar structure.
+ * @param direction: The bar direction (OLED_BAR_HORIZONTAL or OLED_BAR_VERTICAL).
+ * @param page:      The first (top) page of the bar.
+ * @param col:       The first (left) column of the bar.
+ * @param width:     The number of columns of the bar.
+ * @param pages:     The number of pages (height / 8) of the bar.
+ * @param min:       The value of an empty bar.
+ * @param max:       The value of a full bar.
+ *
+ * @note If the bar does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_BarInit( OLED_Bar * bar , uint8 direction , uint8 page , uint8 col , uint8 width , uint8 pages , sint16 min , sint16 max )
+{
+
+	/* Ensure the Bar Fits in the Display */
+	if( ( width == 0 ) || ( pages == 0 ) || ( ( col + width ) > OLED_TOTAL_COLS ) || ( ( page + pages ) > OLED_TOTAL_PAGES ) )
+	{
+		/* Mark the Bar as Invalid */
+		bar->width = 0;
+		return;
+	}
+
+
+	/* Store the Bar Data */
+	bar->min       = min;
+	bar->max       = max;
+	bar->direction = direction;
+	bar->page      = page;
+	bar->col       = col;
+	bar->width     = width;
+	bar->pages     = pages;
+	bar->level     = 0;
+
+
+	/* Draw the Whole Empty Bar */
+	OLED_BarDrawRegion( bar , 0 , pages - 1 , 0 , width - 1 );
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Sets the value of a bar graph.
+ *
+ * Only the part of the bar between the old and the new level is sent to the display:
+ * the changed columns for a horizontal bar, or the changed pages for a vertical bar.
+ *
+ * @param bar:   Pointer to the bar structure.
+ * @param value: The new value (clamped to the bar range).
+ */
+void OLED_BarSetValue( OLED_Bar * bar , sint16 value )
+{
+
+	/* Ignore Invalid Bars */
+	if( bar->width == 0 )
+	{
+		return;
+	}
+
+
+	/* Save the Old Level and Calculate the New Level */
+	uint8 oldLevel = bar->level;
+	uint8 newLevel;
+
+	if( bar->direction == OLED_BAR_HORIZONTAL )
+	{
+		/* Level in Filled Columns */
+		newLevel = OLED_WidgetScale( value , bar->min , bar->max , bar->width );
+	}
+	else
+	{
+		/* Level in Filled Rows */
+		newLevel = OLED_WidgetScale( value , bar->min , bar->max , bar->pages * OLED_PAGE_HEIGHT );
+	}
+
+	/* Nothing to Draw if the Level did not Change */
+	if( newLevel == oldLevel )
+	{
+		return;
+	}
+
+	bar->level = newLevel;
+
+
+	/* Get the Lower and Higher Levels */
+	uint8 lowLevel  = ( oldLevel < newLevel ) ? oldLevel : newLevel;
+	uint8 highLevel = ( oldLevel < newLevel ) ? newLevel : oldLevel;
+
+	if( bar->direction == OLED_BAR_HORIZONTAL )
+	{
+		/* Draw Only the Columns Between the Old and the New Level */
+		OLED_BarDrawRegion( bar , 0 , bar->pages - 1 , lowLevel , highLevel - 1 );
+	}
+	else
+	{
+		/* Draw Only the Pages that Hold the Rows Between the Old and the New Level (Rows Counted from the Bottom) */
+		uint8 height = bar->pages * OLED_PAGE_HEIGHT;
+		OLED_BarDrawRegion( bar , ( height - highLevel ) / OLED_PAGE_HEIGHT , ( height - 1 - lowLevel ) / OLED_PAGE_HEIGHT , 0 , bar->width - 1 );
+	}
+
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Initializes a one page gauge and draws its scale.
+ *
+ * The gauge shows the current value as a pointer and the lowest and highest values
+ * since the last reset as markers.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ * @param page:  The page of the gauge.
+ * @param col:   The first (left) column of the gauge.
+ * @param width: The number of columns of the gauge.
+ * @param min:   The value at the left end of the gauge.
+ * @param max:   The value at the right end of the gauge.
+ *
+ * @note If the gauge does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_GaugeInit( OLED_Gauge * gauge , uint8 page , uint8 col , uint8 width , sint16 min , sint16 max )
+{
+
+	/* Ensure the Gauge Fits in the Display */
+	if( ( width == 0 ) || ( ( col + width ) > OLED_TOTAL_COLS ) || ( page >= OLED_TOTAL_PAGES ) )
+	{
+		/* Mark the Gauge as Invalid */
+		gauge->width = 0;
+		return;
+	}
+
+
+	/* Store the Gauge Data */
+	gauge->min       = min;
+	gauge->max       = max;
+	gauge->page      = page;
+	gauge->col       = col;
+	gauge->width     = width;
+	gauge->position  = OLED_GAUGE_NO_MARKER;
+	gauge->minMarker = OLED_GAUGE_NO_MARKER;
+	gauge->maxMarker = OLED_GAUGE_NO_MARKER;
+
+
+	/* Draw the Gauge Scale in a Single Data Transaction */
+	OLED_BeginData( page , col );
+
+	for( uint8 index = 0 ; index < width ; index++ )
+	{
+		I2C_WriteData( OLED_GAUGE_SCALE_BYTE );
+	}
+
+	I2C_Stop();
+
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Sets the value of a gauge and updates its min and max markers.
+ *
+ * Nothing is sent if the pointer column does not change, otherwise only the columns
+ * of the old and new pointer and of the markers that moved are sent to the display.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ * @param value: The new value (clamped to the gauge range).
+ */
+void OLED_GaugeSetValue( OLED_Gauge * gauge , sint16 value )
+{
+
+	/* Ignore Invalid Gauges */
+	if( gauge->width == 0 )
+	{
+		return;
+	}
+
+
+	/* Get the New Pointer Column */
+	uint8 position = OLED_WidgetScale( value , gauge->min , gauge->max , gauge->width - 1 );
+
+	/* Nothing to Draw if the Pointer did not Move (the Markers Move only with the Pointer) */
+	if( position == gauge->position )
+	{
+		return;
+	}
+
+
+	/* Columns to Draw: the Old and New Pointer and the Old Column of each Moved Marker */
+	uint8 columns[ 4 ];
+
+	columns[ 0 ] = gauge->position;
+	columns[ 1 ] = position;
+	columns[ 2 ] = OLED_GAUGE_NO_MARKER;
+	columns[ 3 ] = OLED_GAUGE_NO_MARKER;
+
+	gauge->position = position;
+
+	/* Update the Markers (their New Column is the Pointer Column) */
+	if( ( gauge->minMarker == OLED_GAUGE_NO_MARKER ) || ( position < gauge->minMarker ) )
+	{
+		columns[ 2 ] = gauge->minMarker;
+		gauge->minMarker = position;
+	}
+
+	if( ( gauge->maxMarker == OLED_GAUGE_NO_MARKER ) || ( position > gauge->maxMarker ) )
+	{
+		columns[ 3 ] = gauge->maxMarker;
+		gauge->maxMarker = position;
+	}
+
+
+	/* Draw Each Changed Column Once */
+	OLED_GaugeDrawColumns( gauge , columns , 4 );
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+/*
+ * @brief Resets the min and max markers of a gauge to its current value.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ */
+void OLED_GaugeResetMarkers( OLED_Gauge * gauge )
+{
+
+	/* Ignore Invalid Gauges */
+	if( gauge->width == 0 )
+	{
+		return;
+	}
+
+
+	/* Columns that May Need to be Drawn: the Old Markers */
+	uint8 columns[ 2 ];
+
+	columns[ 0 ] = gauge->minMarker;
+	columns[ 1 ] = gauge->maxMarker;
+
+
+	/* Move the Markers to the Pointer */
+	gauge->minMarker = gauge->position;
+	gauge->maxMarker = gauge->position;
+
+
+	/* Draw the Old Markers Columns */
+	OLED_GaugeDrawColumns( gauge , columns , 2 );
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+
+
+
+
+#if OLED_TILES_MODE == OLED_TILES_ENABLE
+
+/*
+ * @brief Marks the tiles under an 8x8 pixels area dirty.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param x: The column of the area left edge in pixels.
+ * @param y: The row of the area top edge in pixels.
+ */
+static void OLED_TilesMarkArea( uint8 x , uint8 y )
+{
+
+	/* Get the Tiles Under the First and Last Pixels of the Area */
+	uint8 firstCol = x / OLED_TILE_SIZE;
+	uint8 firstRow = y / OLED_TILE_SIZE;
+	uint8 lastCol  = ( (uint16) x + OLED_TILE_SIZE - 1 ) / OLED_TILE_SIZE;
+	uint8 lastRow  = ( (uint16) y + OLED_TILE_SIZE - 1 ) / OLED_TILE_SIZE;
+
+	/* Mark the Tiles Inside the Map Dirty */
+	for( uint8 row = firstRow ; ( row <= lastRow ) && ( row < OLED_TILE_ROWS ) ; row++ )
+	{
+		for( uint8 col = firstCol ; ( col <= lastCol ) && ( col < OLED_TILE_COLS ) ; col++ )
+		{
+			OLED_TileDirty[ row ] |= ( (uint16) 1 << col );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Composes the column bytes of a tile with the sprites over it.
+ *
+ * This function is not intended for direct use by the user. It copies the tile from the
+ * tileset, then draws each shown sprite that overlaps the tile through its mask,
+ * shifting the sprite bytes to the tile page.
+ *
+ * @param col:   The map column of the tile.
+ * @param row:   The map row of the tile.
+ * @param bytes: The 8 composed column bytes (output).
+ */
+static void OLED_TileCompose( uint8 col , uint8 row , uint8 * bytes )
+{
+
+	/* Get the Tile Image in the Tileset */
+	const uint8 * tile = & OLED_Tileset[ OLED_TileMap[ row ][ col ] * OLED_TILE_SIZE ];
+
+	/* Copy the Tile Image */
+	for( uint8 index = 0 ; index < OLED_TILE_SIZE ; index++ )
+	{
+		bytes[ index ] = pgm_read_byte( & tile[ index ] );
+	}
+
+
+	/* Get the Tile Position in Pixels */
+	uint8 tileX = col * OLED_TILE_SIZE;
+	uint8 tileY = row * OLED_TILE_SIZE;
+
+	for( uint8 id = 0 ; id < OLED_SPRITES_NUM ; id++ )
+	{
+
+		OLED_Sprite * sprite = & OLED_Sprites[ id ];
+
+		/* Skip Hidden Sprites and Sprites that do not Overlap the Tile */
+		if( ( sprite->visible == false ) ||
+			( ( sprite->x + OLED_TILE_SIZE ) <= tileX ) || ( sprite->x >= ( tileX + OLED_TILE_SIZE ) ) ||
+			( ( sprite->y + OLED_TILE_SIZE ) <= tileY ) || ( sprite->y >= ( tileY + OLED_TILE_SIZE ) ) )
+		{
+			continue;
+		}
+
+
+		/* Get the Vertical Shift from the Sprite Rows to the Tile Rows (-7 to 7) */
+		sint16 shift = (sint16) sprite->y - tileY;
+
+		for( uint8 index = 0 ; index < OLED_TILE_SIZE ; index++ )
+		{
+
+			/* Get the Sprite Column Drawn in this Tile Column (wraps to a large value left of the sprite) */
+			uint8 spriteCol = tileX + index - sprite->x;
+
+			if( spriteCol < OLED_TILE_SIZE )
+			{
+
+				/* Read the Sprite Column Image and Mask */
+				uint8 image = pgm_read_byte( & sprite->image[ spriteCol ] );
+				uint8 mask  = pgm_read_byte( & sprite->mask[ spriteCol ] );
+
+				/* Shift them to the Tile Rows */
+				if( shift >= 0 )
+				{
+					image <<= shift;
+					mask  <<= shift;
+				}
+				else
+				{
+					image >>= -shift;
+					mask  >>= -shift;
+				}
+
+				/* Replace the Tile Pixels Under the Mask with the Sprite Pixels */
+				bytes[ index ] = ( bytes[ index ] & ~mask ) | ( image & mask );
+			}
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initializes the tile engine with a tileset.
+ *
+ * All the map cells are set to tile 0, all the sprites are hidden and all the tiles are
+ * marked dirty, so the next `OLED_TilesFlush` draws the whole screen.
+ *
+ * @param tileset: The tiles in program memory, 8 column bytes per tile (such as `const uint8 tiles[][8] PROGMEM`).
+ */
+void OLED_TilesInit( const uint8 * tileset )
+{
+
+	/* Store the Tileset */
+	OLED_Tileset = tileset;
+
+
+	/* Set All the Map Cells to Tile 0 and Mark them Dirty */
+	for( uint8 row = 0 ; row < OLED_TILE_ROWS ; row++ )
+	{
+		for( uint8 col = 0 ; col < OLED_TILE_COLS ; col++ )
+		{
+			OLED_TileMap[ row ][ col ] = 0;
+		}
+
+		OLED_TileDirty[ row ] = OLED_TILES_ROW_MASK;
+	}
+
+
+	/* Hide All the Sprites */
+	for( uint8 id = 0 ; id < OLED_SPRITES_NUM ; id++ )
+	{
+		OLED_Sprites[ id ].visible = false;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets the tile of a map cell.
+ *
+ * The cell is marked dirty only if its tile changed.
+ *
+ * @param col:  The map column (valid range: 0 to OLED_TILE_COLS - 1).
+ * @param row:  The map row (valid range: 0 to OLED_TILE_ROWS - 1).
+ * @param tile: The tile index in the tileset.
+ */
+void OLED_TilesSetTile( uint8 col , uint8 row , uint8 tile )
+{
+
+	/* Ensure the Specified Cell is within Valid Bounds and its Tile Changed */
+	if( ( col < OLED_TILE_COLS ) && ( row < OLED_TILE_ROWS ) && ( OLED_TileMap[ row ][ col ] != tile ) )
+	{
+		/* Set the Cell Tile */
+		OLED_TileMap[ row ][ col ] = tile;
+
+		/* Mark the Cell Dirty */
+		OLED_TileDirty[ row ] |= ( (uint16) 1 << col );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Loads the whole tile map from program memory.
+ *
+ * Only the cells whose tile changed are marked dirty.
+ *
+ * @param map: The tile indices in program memory, row by row (OLED_TILE_ROWS × OLED_TILE_COLS bytes).
+ */
+void OLED_TilesLoadMap( const uint8 * map )
+{
+
+	/* Set the Tile of Each Cell */
+	for( uint8 row = 0 ; row < OLED_TILE_ROWS ; row++ )
+	{
+		for( uint8 col = 0 ; col < OLED_TILE_COLS ; col++ )
+		{
+			OLED_TilesSetTile( col , row , pgm_read_byte( & map[ row * OLED_TILE_COLS + col ] ) );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Retrieves the tile of a map cell.
+ *
+ * @param col: The map column (valid range: 0 to OLED_TILE_COLS - 1).
+ * @param row: The map row (valid range: 0 to OLED_TILE_ROWS - 1).
+ *
+ * @return: The tile index of the cell, or 0 if the cell is out of bounds.
+ */
+uint8 OLED_TilesGetTile( uint8 col , uint8 row )
+{
+
+	/* Ensure the Specified Cell is within Valid Bounds */
+	if( ( col < OLED_TILE_COLS ) && ( row < OLED_TILE_ROWS ) )
+	{
+		return OLED_TileMap[ row ][ col ];
+	}
+
+	return 0;
+}
+
+
+
+
+
+/*
+ * @brief Sets the image and the mask of a sprite.
+ *
+ * The sprite pixels where the mask is 1 replace the tile pixels (on or off),
+ * the pixels where the mask is 0 are transparent. Sprites with higher IDs are drawn on top.
+ *
+ * @param id:    The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ * @param image: The sprite image in program memory (8 column bytes).
+ * @param mask:  The sprite mask in program memory (8 column bytes).
+ */
+void OLED_SpriteSetImage( uint8 id , const uint8 * image , const uint8 * mask )
+{
+
+	/* Ensure the Specified Sprite ID is within Valid Bounds */
+	if( id < OLED_SPRITES_NUM )
+	{
+
+		/* Set the Sprite Image and Mask */
+		OLED_Sprites[ id ].image = image;
+		OLED_Sprites[ id ].mask  = mask;
+
+		/* Mark the Tiles Under the Sprite Dirty if it is Shown */
+		if( OLED_Sprites[ id ].visible == true )
+		{
+			OLED_TilesMarkArea( OLED_Sprites[ id ].x , OLED_Sprites[ id ].y );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Moves a sprite and shows it.
+ *
+ * The tiles under the old and the new sprite positions are marked dirty.
+ *
+ * @param id: The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ * @param x:  The column of the sprite left edge in pixels.
+ * @param y:  The row of the sprite top edge in pixels.
+ */
+void OLED_SpriteMove( uint8 id , uint8 x , uint8 y )
+{
+
+	/* Ensure the Specified Sprite ID is within Valid Bounds */
+	if( id < OLED_SPRITES_NUM )
+	{
+
+		OLED_Sprite * sprite = & OLED_Sprites[ id ];
+
+		/* Nothing Changes if the Shown Sprite did not Move */
+		if( ( sprite->visible == true ) && ( sprite->x == x ) && ( sprite->y == y ) )
+		{
+			return;
+		}
+
+
+		/* Mark the Tiles Under the Old Position Dirty */
+		if( sprite->visible == true )
+		{
+			OLED_TilesMarkArea( sprite->x , sprite->y );
+		}
+
+		/* Move and Show the Sprite */
+		sprite->x       = x;
+		sprite->y       = y;
+		sprite->visible = true;
+
+		/* Mark the Tiles Under the New Position Dirty */
+		OLED_TilesMarkArea( x , y );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Hides a sprite.
+ *
+ * The tiles under the sprite are marked dirty.
+ *
+ * @param id: The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ */
+void OLED_SpriteHide( uint8 id )
+{
+
+	/* Ensure the Specified Sprite ID is within Valid Bounds and the Sprite is Shown */
+	if( ( id < OLED_SPRITES_NUM ) && ( OLED_Sprites[ id ].visible == true ) )
+	{
+		/* Hide the Sprite */
+		OLED_Sprites[ id ].visible = false;
+
+		/* Mark the Tiles Under the Sprite Dirty */
+		OLED_TilesMarkArea( OLED_Sprites[ id ].x , OLED_Sprites[ id ].y );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends the dirty tiles to the display.
+ *
+ * Each dirty tile is composed from its tileset image and the sprites over it, then
+ * neighboring dirty tiles of the same row are sent in a single I2C data transaction.
+ * Tiles that were not changed since the last flush are not sent.
+ *
+ * @note The text cursor address is restored after sending the tiles.
+ */
+void OLED_TilesFlush( void )
+{
+
+	/* Column Bytes of the Tile being Composed */
+	uint8 bytes[ OLED_TILE_SIZE ];
+
+	for( uint8 row = 0 ; row < OLED_TILE_ROWS ; row++ )
+	{
+
+		/* Skip Rows without Dirty Tiles */
+		if( OLED_TileDirty[ row ] == 0 )
+		{
+			continue;
+		}
+
+
+		uint8 col = 0;
+
+		while( col < OLED_TILE_COLS )
+		{
+
+			/* Skip Clean Tiles */
+			if( GET_BIT( OLED_TileDirty[ row ] , col ) == 0 )
+			{
+				col++;
+				continue;
+			}
+
+
+			/* Start a Data Transaction at the First Tile of the Run of Dirty Tiles */
+			OLED_BeginData( row , col * OLED_TILE_SIZE );
+
+			/* Send the Run of Dirty Tiles */
+			while( ( col < OLED_TILE_COLS ) && ( GET_BIT( OLED_TileDirty[ row ] , col ) == 1 ) )
+			{
+				/* Compose the Tile with the Sprites Over it */
+				OLED_TileCompose( col , row , bytes );
+
+				for( uint8 index = 0 ; index < OLED_TILE_SIZE ; index++ )
+				{
+					I2C_WriteData( bytes[ index ] );
+				}
+
+				col++;
+			}
+
+			/* Stop I2C Communication */
+			I2C_Stop();
+		}
+
+
+		/* All the Tiles of the Row are Clean */
+		OLED_TileDirty[ row ] = 0;
+	}
+
+
+	/* Restore the Text Cursor Address */
+	OLED_SetAddress( OLED_CURSOR_PAGE , OLED_CURSOR_COL );
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Retrieves the current page position of the cursor on the OLED display.
+ *
+ * This function returns the current page where the cursor is positioned.
+ *
+ * @return: The current page position (0-7).
+ */
+uint8 OLED_GetPage( void )
+{
+	/* Returns the Current Page Position of the Cursor on the OLED Display */
+	return OLED_CURSOR_PAGE;
+}
+
+
+
+
+
+/*
+ * @brief Retrieves the current column position of the cursor on the OLED display.
+ *
+ * This function returns the current column where the cursor is positioned.
+ *
+ * @return: The current column position (0-127).
+ */
+uint8 OLED_GetColumn( void )
+{
+	/* Returns the Current Column Position of the Cursor on the OLED Display */
+	return OLED_CURSOR_COL;
+}
+
+
+
+
+
+#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+
+/*
+ * @brief Retrieves the display RAM page shown at the top of the screen in console mode.
+ *
+ * In console mode the pages used by `OLED_SetCursor` and `OLED_GetPage` are display RAM
+ * pages. The visible line number of a page is `( page - top_page ) % OLED_RAM_PAGES`,
+ * pages with a line number of OLED_TOTAL_PAGES or more are below the screen.
+ *
+ * @return: The display RAM page shown at the top of the screen (0-7).
+ */
+uint8 OLED_GetConsoleTopPage( void )
+{
+	/* Returns the Display RAM Page Shown at the Top of the Screen */
+	return OLED_CONSOLE_TOP_PAGE;
+}
+
+#endif
+
+
+
+
+
+#if OLED_FRAMEBUFFER_MODE != OLED_FRAMEBUFFER_DISABLE
+
+/*
+ * @brief Retrieves the frame buffer that the drawing functions write into.
+ *
+ * The frame buffer holds `OLED_FRAMEBUFFER_PAGES` pages of `OLED_TOTAL_COLS` bytes each,
+ * starting from `OLED_FRAMEBUFFER_FIRST_PAGE`. Each byte is a vertical column of 8 pixels
+ * with the least significant bit as the top pixel, the same as the display RAM.
+ * In double buffer mode this is the back buffer.
+ *
+ * @return: Pointer to the frame buffer.
+ */
+uint8 * OLED_GetBuffer( void )
+{
+
+	#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_SINGLE
+
+		/* Return the Only Frame Buffer */
+		return OLED_FrameBuffer;
+
+	#else
+
+		/* Return the Back Buffer */
+		return OLED_FrameBuffers[ OLED_BackBufferIndex ];
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Clears the frame buffer by writing zeros to all of its bytes.
+ *
+ * The display is not changed until the frame buffer is sent to it.
+ */
+void OLED_ClearBuffer( void )
+{
+
+	/* Get the Frame Buffer to Clear */
+	uint8 * buffer = OLED_GetBuffer();
+
+	/* Write Zeros to All the Frame Buffer Bytes */
+	for( uint16 byte = 0 ; byte < OLED_FRAMEBUFFER_SIZE ; byte++ )
+	{
+		buffer[ byte ] = 0x00;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets, clears or inverts a single pixel in the frame buffer.
+ *
+ * Pixels outside the display or outside the pages held by the frame buffer are ignored.
+ *
+ * @param x:     The pixel column (valid range: 0 to OLED_TOTAL_COLS - 1).
+ * @param y:     The pixel row (valid range: 0 to OLED_TOTAL_ROW - 1).
+ * @param color: The pixel color (OLED_PIXEL_OFF, OLED_PIXEL_ON, OLED_PIXEL_INVERT).
+ */
+void OLED_DrawPixel( uint8 x , uint8 y , uint8 color )
+{
+
+	/* Get the Page that Holds the Pixel Row */
+	uint8 page = y / OLED_PAGE_HEIGHT;
+
+	/* Ensure the Pixel is within the Display and the Frame Buffer Pages */
+	if( ( x < OLED_TOTAL_COLS ) && ( (uint8)( page - OLED_FRAMEBUFFER_FIRST_PAGE ) < OLED_FRAMEBUFFER_PAGES ) )
+	{
+
+		/* Get the Frame Buffer Byte that Holds the Pixel */
+		uint8 * byte = & OLED_GetBuffer()[ ( page - OLED_FRAMEBUFFER_FIRST_PAGE ) * OLED_TOTAL_COLS + x ];
+
+		/* Check the Required Color */
+		switch( color )
+		{
+			case OLED_PIXEL_ON:		SET_BIT( *byte , y % OLED_PAGE_HEIGHT );	break;
+			case OLED_PIXEL_OFF:	CLR_BIT( *byte , y % OLED_PAGE_HEIGHT );	break;
+			case OLED_PIXEL_INVERT:	TOG_BIT( *byte , y % OLED_PAGE_HEIGHT );	break;
+		}
+	}
+}
+
+#endif
+
+
+
+
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_SINGLE
+
+/*
+ * @brief Sends the frame buffer to the display.
+ *
+ * This function sets the address window to the pages held by the frame buffer and
+ * streams the whole frame buffer in a single I2C data transaction, blocking until it ends.
+ * In page addressing mode (SH1106) it sends one I2C data transaction per page.
+ *
+ * @note The display RAM address window is changed, call `OLED_SetCursor` before printing text.
+ */
+void OLED_UpdateScreen( void )
+{
+
+#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
+
+	for( uint8 page = 0 ; page < OLED_FRAMEBUFFER_PAGES ; page++ )
+	{
+
+		/* Set the Page Address Command to the Page being Sent */
+		OLED_FrameBufferHeader[ 1 ] = OLED_SET_PAGE_START | ( OLED_FRAMEBUFFER_FIRST_PAGE + page );
+
+		/* Start I2C Communication */
+		I2C_Start();
+
+		/* Send OLED Slave Address with Write Instruction */
+		I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+
+		/* Set the Address to the Start of the Page and Set OLED to Data Mode */
+		for( uint8 byte = 0 ; byte < sizeof( OLED_FrameBufferHeader ) ; byte++ )
+		{
+			I2C_WriteData( OLED_FrameBufferHeader[ byte ] );
+		}
+
+
+		/* Write the Frame Buffer Page */
+		for( uint8 col = 0 ; col < OLED_TOTAL_COLS ; col++ )
+		{
+			I2C_WriteData( OLED_FrameBuffer[ page * OLED_TOTAL_COLS + col ] );
+		}
+
+
+		/* Stop I2C Communication */
+		I2C_Stop();
+	}
+
+#else
+
+	/* Start I2C Communication */
+	I2C_Start();
+
+	/* Send OLED Slave Address with Write Instruction */
+	I2C_SendSlaveAddress_Write( OLED_ADDRESS );
+
+
+	/* Set the Address Window to the Frame Buffer Pages and Set OLED to Data Mode */
+	for( uint8 byte = 0 ; byte < sizeof( OLED_FrameBufferHeader ) ; byte++ )
+	{
+		I2C_WriteData( OLED_FrameBufferHeader[ byte ] );
+	}
+
+
+	/* Write the Whole Frame Buffer */
+	for( uint16 byte = 0 ; byte < OLED_FRAMEBUFFER_SIZE ; byte++ )
+	{
+		I2C_WriteData( OLED_FrameBuffer[ byte ] );
+	}
+
+
+	/* Stop I2C Communication */
+	I2C_Stop();
+
+#endif
+}
+
+#endif
+
+
+
+
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_DOUBLE
+
+#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
+
+/*
+ * @brief Starts sending the next front buffer page to the display in the background.
+ *
+ * This function is not intended for direct use by the user. It is called by `OLED_SwapBuffers`
+ * for the first page, then by the I2C interrupt as the completion callback of each page,
+ * so the pages are sent one after the other without blocking (page addressing mode
+ * does not move to the next page by itself).
+ */
+static void OLED_FlushNextPage( void )
+{
+
+	/* Stop Sending the Frame if the Previous Page Failed */
+	if( ( OLED_FlushPage != 0 ) && ( I2C_GetAsyncResult() != SUCCESS ) )
+	{
+		OLED_FlushPage = OLED_FRAMEBUFFER_PAGES;
+		return;
+	}
+
+
+	/* Check if there are Pages Left to be Sent */
+	if( OLED_FlushPage < OLED_FRAMEBUFFER_PAGES )
+	{
+
+		/* Set the Page Address Command to the Page being Sent */
+		OLED_FrameBufferHeader[ 1 ] = OLED_SET_PAGE_START | ( OLED_FRAMEBUFFER_FIRST_PAGE + OLED_FlushPage );
+
+		/* Start Sending the Page, this Function is Called Again when it Ends */
+		if( I2C_MasterWriteAsync( OLED_FlushAddress , OLED_FrameBufferHeader , sizeof( OLED_FrameBufferHeader ) ,
+								  & OLED_FlushBuffer[ OLED_FlushPage * OLED_TOTAL_COLS ] , OLED_TOTAL_COLS , & OLED_FlushNextPage ) == SUCCESS )
+		{
+			/* Move to the Next Page */
+			OLED_FlushPage++;
+		}
+		else
+		{
+			/* Stop Sending the Frame */
+			OLED_FlushPage = OLED_FRAMEBUFFER_PAGES;
+		}
+	}
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Swaps the frame buffers and starts streaming the new front buffer to the display.
+ *
+ * The back buffer that was drawn becomes the front buffer and is sent to the display
+ * in the background by the I2C interrupt (see `I2C_MasterWriteAsync`), while the application
+ * draws the next frame into the other buffer. If the previous frame is still being sent,
+ * the function either waits for it to end or returns immediately without swapping.
+ *
+ * @param wait: If `true`, wait for the previous frame to end. If `false`, return ERROR if it is still being sent.
+ *
+ * @return: SUCCESS if the buffers were swapped, ERROR if the previous frame is still being sent.
+ *
+ * @note The new back buffer holds the frame before the previous one, so it must be redrawn (or cleared).
+ *       Global interrupts must be enabled, and no other OLED or I2C function can be used while
+ *       `OLED_IsFlushBusy` returns true.
+ */
+uint8 OLED_SwapBuffers( uint8 wait )
+{
+
+	/* Check if the Previous Frame is Still being Sent */
+	if( OLED_IsFlushBusy() )
+	{
+		/* Return Busy if Waiting is not Requested */
+		if( wait == false )
+		{
+			return ERROR;
+		}
+
+		/* Wait Until the Previous Frame Ends */
+		while( OLED_IsFlushBusy() );
+	}
+
+
+#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
+
+	/* Start Sending the Back Buffer Page by Page in the Background, it Becomes the Front Buffer */
+	OLED_FlushBuffer  = OLED_FrameBuffers[ OLED_BackBufferIndex ];
+	OLED_FlushAddress = OLED_ADDRESS;
+	OLED_FlushPage    = 0;
+
+	OLED_FlushNextPage();
+
+	/* Check if the First Page Started */
+	if( I2C_IsAsyncBusy() == false )
+	{
+		return ERROR;
+	}
+
+#else
+
+	/* Start Sending the Back Buffer in the Background, it Becomes the Front Buffer */
+	if( I2C_MasterWriteAsync( OLED_ADDRESS , OLED_FrameBufferHeader , sizeof( OLED_FrameBufferHeader ) ,
+							  OLED_FrameBuffers[ OLED_BackBufferIndex ] , OLED_FRAMEBUFFER_SIZE , NULL ) != SUCCESS )
+	{
+		return ERROR;
+	}
+
+#endif
+
+	/* Draw the Next Frame into the Other Buffer */
+	OLED_BackBufferIndex ^= 1;
+
+	return SUCCESS;
+}
+
+
+
+
+
+/*
+ * @brief Checks if the front buffer is still being sent to the display.
+ *
+ * @return: 1 if the front buffer is still being sent, otherwise 0.
+ */
+uint8 OLED_IsFlushBusy( void )
+{
+
+#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_PAGE
+
+	/* Returns Busy while Pages are Left to be Sent or the Last Page is being Sent */
+	return ( OLED_FlushPage < OLED_FRAMEBUFFER_PAGES ) || I2C_IsAsyncBusy();
+
+#else
+
+	/* Returns the State of the Asynchronous I2C Transfer */
+	return I2C_IsAsyncBusy();
+
+#endif
+}
+
+#endif
 
 
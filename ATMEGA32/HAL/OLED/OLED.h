@@ -8,16 +8,21 @@
  *
  * @details
  * This driver provides an abstraction layer for controlling OLED displays
- * based on the SSD1306 controller using I2C communication protocol.
+ * based on the SSD1306 or SH1106 controllers using I2C communication protocol.
  * It includes initialization, command/data transmission, screen control,
  * and basic character printing functionalities.
  *
  * The OLED driver includes the following functionalities:
  * - OLED initialization and power control.
+ * - Compile-time panel size (128x64, 128x32, ...) and controller (SSD1306, SH1106).
+ * - Optional multiple panels on the same I2C bus, each with its own address and cursor.
  * - Text rendering: characters, strings, and numbers.
  * - Cursor control with paging and column addressing.
- * - Scrolling capabilities: horizontal, vertical, and diagonal.
+ * - Scrolling capabilities: horizontal, vertical, and diagonal (SSD1306 only).
  * - Screen clearing and logic inversion.
+ * - Sensor dashboard widgets (sparkline chart, bar graphs, gauge) with partial updates.
+ * - Optional SRAM frame buffer, single (blocking) or double (interrupt-driven flush).
+ * - Optional tile engine: 8x8 tile map with masked sprites, sending only the dirty tiles.
  * - Low-level I2C command and data sending.
  *
  * @note
@@ -53,6 +58,36 @@ extern const uint16 FontTableSize;
 void OLED_Init( void );
 
 
+#if OLED_PANELS_MODE == OLED_PANELS_MULTIPLE
+
+/*
+ * @brief Prepares the handle of one OLED panel.
+ *
+ * The handle holds the I2C address and the cursor of the panel, so several panels
+ * with different addresses (such as 0x3C and 0x3D) can share the same I2C bus.
+ *
+ * @param display: Pointer to the panel handle.
+ * @param address: The 7-bit I2C address of the panel (OLED_SLAVE_ADDRESS or OLED_SLAVE_ADDRESS_ALT).
+ */
+void OLED_CreateDisplay( OLED_Display * display , uint8 address );
+
+
+/*
+ * @brief Selects the OLED panel that all the other OLED functions use.
+ *
+ * The selected handle must remain valid while it is selected. Call `OLED_Init` once
+ * for each panel after selecting it.
+ *
+ * @param display: Pointer to the panel handle (prepared by `OLED_CreateDisplay`).
+ *
+ * @note The frame buffer and the widgets state are not part of the handle, the frame buffer
+ *       is sent to the panel that is selected when `OLED_UpdateScreen` or `OLED_SwapBuffers` is called.
+ */
+void OLED_SelectDisplay( OLED_Display * display );
+
+#endif
+
+
 /*
  * @brief Turns on the OLED display.
  *
@@ -89,7 +124,7 @@ void OLED_LogicInvertDisplay( uint8 invert );
  * This function updates the current page and column positions based on the selected
  * memory addressing mode.
  *
- * @param page:   The target page (row) for the cursor position (valid range: 0 to OLED_TOTAL_PAGES - 1).
+ * @param page:   The target page (row) for the cursor position (valid range: 0 to OLED_CURSOR_PAGES - 1).
  * @param colunm: The target column for the cursor position (valid range: 0 to OLED_TOTAL_COLS - 1).
  */
 void OLED_SetCursor( uint8 page , uint8 col );
@@ -100,10 +135,25 @@ void OLED_SetCursor( uint8 page , uint8 col );
  *
  * This function increments the current page and resets the column to the first position.
  * If the cursor is on the last page, it wraps around to the first page.
+ *
+ * In console mode (`OLED_CONSOLE_ENABLE`), if the cursor is on the last visible line,
+ * the text is scrolled up one page in hardware by moving the display start line,
+ * and only the newly exposed line is cleared.
  */
 void OLED_GoToNextLine( void );
 
 
+/*
+ * @brief Clears a single page (8 rows) of the OLED display.
+ *
+ * This function writes zeros to all the columns of the specified page
+ * and then leaves the cursor at the start of that page.
+ *
+ * @param page: The page to be cleared (valid range: 0 to OLED_CURSOR_PAGES - 1).
+ */
+void OLED_ClearPage( uint8 page );
+
+
 /*
  * @brief Clears the OLED display by writing zeros to all pixels.
  *
@@ -113,6 +163,8 @@ void OLED_GoToNextLine( void );
 void OLED_ClearScreen( void );
 
 
+#if OLED_CONTROLLER == OLED_CONTROLLER_SSD1306
+
 /*
  * @brief Deactivates any active scrolling on the OLED display.
  *
@@ -172,6 +224,8 @@ void OLED_ScrollVertical( uint8 scroll_speed, uint8 vertical_offset );
  */
 void OLED_Scroll( uint8 direction , uint8 start_page, uint8 end_page, uint8 scroll_speed, uint8 vertical_offset );
 
+#endif
+
 
 /*
  * @brief Sends a command to the OLED display without restarting communication.
@@ -211,8 +265,11 @@ void OLED_PrintCharacter( uint8 character );
 /*
  * @brief Prints a null-terminated string on the OLED display.
  *
- * This function iterates through each character in the provided string
- * and prints.
+ * This function streams the font columns and spacing bytes of all the characters
+ * that fit in the current line within a single I2C data transaction, instead of
+ * one transaction per character. When the line is full or a '\n' is found, the
+ * transaction is closed, the address window is moved to the next line and a new
+ * transaction is started for the rest of the string.
  *
  * @param Str: Pointer to the null-terminated string to be displayed.
  */
@@ -242,6 +299,207 @@ void OLED_PrintNumber( sint32 Number );
 void OLED_PrintByte( uint8 byte );
 
 
+/*
+ * @brief Initializes a scrolling sparkline chart and draws it empty.
+ *
+ * The chart keeps one sample per column in a ring buffer. Each column is drawn as a
+ * vertical line from the previous sample to its sample, so the samples look connected.
+ *
+ * @param chart:   Pointer to the chart structure.
+ * @param samples: Ring buffer that holds `width` samples (must remain valid while the chart is used).
+ * @param page:    The first (top) page of the chart.
+ * @param col:     The first (left) column of the chart.
+ * @param width:   The number of columns (and samples) of the chart.
+ * @param pages:   The number of pages (height / 8) of the chart.
+ * @param min:     The sample value drawn at the chart bottom.
+ * @param max:     The sample value drawn at the chart top.
+ *
+ * @note If the chart does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_SparklineInit( OLED_Sparkline * chart , uint8 * samples , uint8 page , uint8 col , uint8 width , uint8 pages , sint16 min , sint16 max );
+
+
+
+/*
+ * @brief Adds a sample to a sparkline chart, shifting it one column to the left.
+ *
+ * The oldest sample is dropped and the new sample is drawn in the right column.
+ * Only the columns whose drawing changed after the shift are sent to the display,
+ * grouping neighboring columns in a single I2C data transaction per page.
+ *
+ * @param chart: Pointer to the chart structure.
+ * @param value: The new sample value (clamped to the chart range).
+ */
+void OLED_SparklineAddSample( OLED_Sparkline * chart , sint16 value );
+
+
+
+/*
+ * @brief Initializes a horizontal or vertical bar graph and draws it empty.
+ *
+ * @param bar:       Pointer to the bar structure.
+ * @param direction: The bar direction (OLED_BAR_HORIZONTAL or OLED_BAR_VERTICAL).
+ * @param page:      The first (top) page of the bar.
+ * @param col:       The first (left) column of the bar.
+ * @param width:     The number of columns of the bar.
+ * @param pages:     The number of pages (height / 8) of the bar.
+ * @param min:       The value of an empty bar.
+ * @param max:       The value of a full bar.
+ *
+ * @note If the bar does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_BarInit( OLED_Bar * bar , uint8 direction , uint8 page , uint8 col , uint8 width , uint8 pages , sint16 min , sint16 max );
+
+
+
+/*
+ * @brief Sets the value of a bar graph.
+ *
+ * Only the part of the bar between the old and the new level is sent to the display:
+ * the changed columns for a horizontal bar, or the changed pages for a vertical bar.
+ *
+ * @param bar:   Pointer to the bar structure.
+ * @param value: The new value (clamped to the bar range).
+ */
+void OLED_BarSetValue( OLED_Bar * bar , sint16 value );
+
+
+
+/*
+ * @brief Initializes a one page gauge and draws its scale.
+ *
+ * The gauge shows the current value as a pointer and the lowest and highest values
+ * since the last reset as markers.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ * @param page:  The page of the gauge.
+ * @param col:   The first (left) column of the gauge.
+ * @param width: The number of columns of the gauge.
+ * @param min:   The value at the left end of the gauge.
+ * @param max:   The value at the right end of the gauge.
+ *
+ * @note If the gauge does not fit in the display, its width is set to 0 and nothing is drawn.
+ */
+void OLED_GaugeInit( OLED_Gauge * gauge , uint8 page , uint8 col , uint8 width , sint16 min , sint16 max );
+
+
+
+/*
+ * @brief Sets the value of a gauge and updates its min and max markers.
+ *
+ * Nothing is sent if the pointer column does not change, otherwise only the columns
+ * of the old and new pointer and of the markers that moved are sent to the display.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ * @param value: The new value (clamped to the gauge range).
+ */
+void OLED_GaugeSetValue( OLED_Gauge * gauge , sint16 value );
+
+
+
+/*
+ * @brief Resets the min and max markers of a gauge to its current value.
+ *
+ * @param gauge: Pointer to the gauge structure.
+ */
+void OLED_GaugeResetMarkers( OLED_Gauge * gauge );
+
+
+#if OLED_TILES_MODE == OLED_TILES_ENABLE
+
+/*
+ * @brief Initializes the tile engine with a tileset.
+ *
+ * All the map cells are set to tile 0, all the sprites are hidden and all the tiles are
+ * marked dirty, so the next `OLED_TilesFlush` draws the whole screen.
+ *
+ * @param tileset: The tiles in program memory, 8 column bytes per tile (such as `const uint8 tiles[][8] PROGMEM`).
+ */
+void OLED_TilesInit( const uint8 * tileset );
+
+
+/*
+ * @brief Sets the tile of a map cell.
+ *
+ * The cell is marked dirty only if its tile changed.
+ *
+ * @param col:  The map column (valid range: 0 to OLED_TILE_COLS - 1).
+ * @param row:  The map row (valid range: 0 to OLED_TILE_ROWS - 1).
+ * @param tile: The tile index in the tileset.
+ */
+void OLED_TilesSetTile( uint8 col , uint8 row , uint8 tile );
+
+
+/*
+ * @brief Loads the whole tile map from program memory.
+ *
+ * Only the cells whose tile changed are marked dirty.
+ *
+ * @param map: The tile indices in program memory, row by row (OLED_TILE_ROWS × OLED_TILE_COLS bytes).
+ */
+void OLED_TilesLoadMap( const uint8 * map );
+
+
+/*
+ * @brief Retrieves the tile of a map cell.
+ *
+ * @param col: The map column (valid range: 0 to OLED_TILE_COLS - 1).
+ * @param row: The map row (valid range: 0 to OLED_TILE_ROWS - 1).
+ *
+ * @return: The tile index of the cell, or 0 if the cell is out of bounds.
+ */
+uint8 OLED_TilesGetTile( uint8 col , uint8 row );
+
+
+/*
+ * @brief Sets the image and the mask of a sprite.
+ *
+ * The sprite pixels where the mask is 1 replace the tile pixels (on or off),
+ * the pixels where the mask is 0 are transparent. Sprites with higher IDs are drawn on top.
+ *
+ * @param id:    The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ * @param image: The sprite image in program memory (8 column bytes).
+ * @param mask:  The sprite mask in program memory (8 column bytes).
+ */
+void OLED_SpriteSetImage( uint8 id , const uint8 * image , const uint8 * mask );
+
+
+/*
+ * @brief Moves a sprite and shows it.
+ *
+ * The tiles under the old and the new sprite positions are marked dirty.
+ *
+ * @param id: The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ * @param x:  The column of the sprite left edge in pixels.
+ * @param y:  The row of the sprite top edge in pixels.
+ */
+void OLED_SpriteMove( uint8 id , uint8 x , uint8 y );
+
+
+/*
+ * @brief Hides a sprite.
+ *
+ * The tiles under the sprite are marked dirty.
+ *
+ * @param id: The sprite ID (valid range: 0 to OLED_SPRITES_NUM - 1).
+ */
+void OLED_SpriteHide( uint8 id );
+
+
+/*
+ * @brief Sends the dirty tiles to the display.
+ *
+ * Each dirty tile is composed from its tileset image and the sprites over it, then
+ * neighboring dirty tiles of the same row are sent in a single I2C data transaction.
+ * Tiles that were not changed since the last flush are not sent.
+ *
+ * @note The text cursor address is restored after sending the tiles.
+ */
+void OLED_TilesFlush( void );
+
+#endif
+
+
 /*
  * @brief Retrieves the current page position of the cursor on the OLED display.
  *
@@ -262,4 +520,106 @@ uint8 OLED_GetPage( void );
 uint8 OLED_GetColumn( void );
 
 
+#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+
+/*
+ * @brief Retrieves the display RAM page shown at the top of the screen in console mode.
+ *
+ * In console mode the pages used by `OLED_SetCursor` and `OLED_GetPage` are display RAM
+ * pages. The visible line number of a page is `( page - top_page ) % OLED_RAM_PAGES`,
+ * pages with a line number of OLED_TOTAL_PAGES or more are below the screen.
+ *
+ * @return: The display RAM page shown at the top of the screen (0-7).
+ */
+uint8 OLED_GetConsoleTopPage( void );
+
+#endif
+
+
+#if OLED_FRAMEBUFFER_MODE != OLED_FRAMEBUFFER_DISABLE
+
+/*
+ * @brief Retrieves the frame buffer that the drawing functions write into.
+ *
+ * The frame buffer holds `OLED_FRAMEBUFFER_PAGES` pages of `OLED_TOTAL_COLS` bytes each,
+ * starting from `OLED_FRAMEBUFFER_FIRST_PAGE`. Each byte is a vertical column of 8 pixels
+ * with the least significant bit as the top pixel, the same as the display RAM.
+ * In double buffer mode this is the back buffer.
+ *
+ * @return: Pointer to the frame buffer.
+ */
+uint8 * OLED_GetBuffer( void );
+
+
+/*
+ * @brief Clears the frame buffer by writing zeros to all of its bytes.
+ *
+ * The display is not changed until the frame buffer is sent to it.
+ */
+void OLED_ClearBuffer( void );
+
+
+/*
+ * @brief Sets, clears or inverts a single pixel in the frame buffer.
+ *
+ * Pixels outside the display or outside the pages held by the frame buffer are ignored.
+ *
+ * @param x:     The pixel column (valid range: 0 to OLED_TOTAL_COLS - 1).
+ * @param y:     The pixel row (valid range: 0 to OLED_TOTAL_ROW - 1).
+ * @param color: The pixel color (OLED_PIXEL_OFF, OLED_PIXEL_ON, OLED_PIXEL_INVERT).
+ */
+void OLED_DrawPixel( uint8 x , uint8 y , uint8 color );
+
+#endif
+
+
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_SINGLE
+
+/*
+ * @brief Sends the frame buffer to the display.
+ *
+ * This function sets the address window to the pages held by the frame buffer and
+ * streams the whole frame buffer in a single I2C data transaction, blocking until it ends.
+ * In page addressing mode (SH1106) it sends one I2C data transaction per page.
+ *
+ * @note The display RAM address window is changed, call `OLED_SetCursor` before printing text.
+ */
+void OLED_UpdateScreen( void );
+
+#endif
+
+
+
+#if OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_DOUBLE
+
+/*
+ * @brief Swaps the frame buffers and starts streaming the new front buffer to the display.
+ *
+ * The back buffer that was drawn becomes the front buffer and is sent to the display
+ * in the background by the I2C interrupt (see `I2C_MasterWriteAsync`), while the application
+ * draws the next frame into the other buffer. If the previous frame is still being sent,
+ * the function either waits for it to end or returns immediately without swapping.
+ *
+ * @param wait: If `true`, wait for the previous frame to end. If `false`, return ERROR if it is still being sent.
+ *
+ * @return: SUCCESS if the buffers were swapped, ERROR if the previous frame is still being sent.
+ *
+ * @note The new back buffer holds the frame before the previous one, so it must be redrawn (or cleared).
+ *       Global interrupts must be enabled, and no other OLED or I2C function can be used while
+ *       `OLED_IsFlushBusy` returns true.
+ */
+uint8 OLED_SwapBuffers( uint8 wait );
+
+
+/*
+ * @brief Checks if the front buffer is still being sent to the display.
+ *
+ * @return: 1 if the front buffer is still being sent, otherwise 0.
+ */
+uint8 OLED_IsFlushBusy( void );
+
+#endif
+
+
 #endif /* OLED_H_ */
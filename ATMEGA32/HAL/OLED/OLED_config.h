@@ -7,8 +7,9 @@
  * @license MIT License Copyright (c) 2025 Boles Medhat
  *
  * @details
- * This file contains configuration options for the SSD1306 controller via I2C.
- * It allows for setting up various parameters such as Clock divider,
+ * This file contains configuration options for the SSD1306 and SH1106 controllers via I2C.
+ * It allows for selecting the controller, the panel size and the number of panels,
+ * and for setting up various parameters such as Clock divider,
  * oscillator frequency settings, Clock divider Multiplex ratio, display offset,
  * start row settings, Display contrast, memory addressing mode, scan direction,
  * Segment and COM remapping options, and Display mode.
@@ -31,6 +32,31 @@
 #include "OLED_def.h"
 
 
+/* Set the OLED Controller
+ * choose between:
+ * 1. OLED_CONTROLLER_SSD1306						<--the most used
+ * 2. OLED_CONTROLLER_SH1106						(1.3" panels, requires OLED_MEMORY_MODE_PAGE)
+*/
+#define OLED_CONTROLLER						OLED_CONTROLLER_SSD1306
+
+
+/* Set the Panel Width in Pixels (valid range: 8 - 128) */
+#define OLED_WIDTH							128		//<--the most used 128
+
+
+/* Set the Panel Height in Pixels (valid values: 16, 32, 64) */
+#define OLED_HEIGHT							64		//<--the most used 64 (128x64), 32 for 128x32 panels
+
+
+/* Set the Number of Panels
+ * choose between:
+ * 1. OLED_PANELS_SINGLE							<--the most used
+ * 2. OLED_PANELS_MULTIPLE							(panels on the same bus with different addresses, see OLED_SelectDisplay)
+*/
+#define OLED_PANELS_MODE					OLED_PANELS_SINGLE
+
+
+
 /* Set the Clock Divider Value (valid range: 0x00 - 0x0F) */
 #define OLED_CLK_DIVIDER					0x00	//<--the most used 0x00
 
@@ -40,8 +66,8 @@
 
 
 
-/* Set the Multiplex Ratio (valid values: 15 - 63) */
-#define OLED_MUX_VALUE						0x3F	//<--the most used 0x3F
+/* Set the Multiplex Ratio (valid values: 15 - OLED_HEIGHT - 1) */
+#define OLED_MUX_VALUE						( OLED_HEIGHT - 1 )	//<--the most used ( OLED_HEIGHT - 1 )
 
 
 
@@ -94,6 +120,46 @@
 
 
 
+/* Set the Text Console Mode
+ * choose between:
+ * 1. OLED_CONSOLE_DISABLE							<--the default
+ * 2. OLED_CONSOLE_ENABLE							(log-style output, scrolls in hardware instead of wrapping)
+*/
+#define OLED_CONSOLE_MODE					OLED_CONSOLE_DISABLE
+
+
+
+/* Set the Frame Buffer Mode
+ * choose between:
+ * 1. OLED_FRAMEBUFFER_DISABLE						<--the default
+ * 2. OLED_FRAMEBUFFER_SINGLE						(blocking OLED_UpdateScreen)
+ * 3. OLED_FRAMEBUFFER_DOUBLE						(non-blocking OLED_SwapBuffers, uses the I2C interrupt)
+*/
+#define OLED_FRAMEBUFFER_MODE				OLED_FRAMEBUFFER_DISABLE
+
+
+/* Set the Pages Held by the Frame Buffer (valid range: 0 - OLED_LAST_PAGE)
+ * Each page takes OLED_WIDTH bytes of SRAM per frame buffer, so for OLED_FRAMEBUFFER_DOUBLE
+ * on a 128x64 panel at most 4 pages (half of the screen) fit in OLED_FRAMEBUFFER_MAX_SIZE.
+ */
+#define OLED_FRAMEBUFFER_FIRST_PAGE			0
+#define OLED_FRAMEBUFFER_LAST_PAGE			OLED_LAST_PAGE
+
+
+
+/* Set the Tile Engine Mode
+ * choose between:
+ * 1. OLED_TILES_DISABLE							<--the default
+ * 2. OLED_TILES_ENABLE								(8x8 tile map with masked sprites, for menus and games)
+*/
+#define OLED_TILES_MODE						OLED_TILES_DISABLE
+
+
+/* Set the Number of Sprites Drawn over the Tile Map (valid range: 1 - 8) */
+#define OLED_SPRITES_NUM					4		//<--the most used 4
+
+
+
 /* You must initialize I2C manually "I2C_Init()" before using this driver */
 #ifndef I2C_IN_HAL
 #define I2C_IN_HAL
@@ -110,7 +176,64 @@
 
 
 /* Error checking for invalid configurations */
-#if	( OLED_CLK_DIVIDER > OLED_LAST_ROW ) || ( OLED_OSCIL_FREQ > 0x0F)
+#if ( OLED_CONTROLLER != OLED_CONTROLLER_SSD1306 ) && ( OLED_CONTROLLER != OLED_CONTROLLER_SH1106 )
+	#error "Wrong \"OLED_CONTROLLER\" configuration option"
+#elif ( OLED_CONTROLLER == OLED_CONTROLLER_SH1106 ) && ( OLED_MEMORY_MODE != OLED_MEMORY_MODE_PAGE )
+	#error "the SH1106 supports OLED_MEMORY_MODE_PAGE only"
+#endif
+
+#if ( OLED_WIDTH < 8 ) || ( OLED_WIDTH > 128 )
+	#error "the OLED_WIDTH value not in range"
+#elif ( OLED_HEIGHT != 16 ) && ( OLED_HEIGHT != 32 ) && ( OLED_HEIGHT != 64 )
+	#error "the OLED_HEIGHT value not valid"
+#else
+	#define OLED_LAST_COL					( OLED_WIDTH - 1 )							/*Last column index in the display (rightmost pixel)*/
+	#define OLED_TOTAL_COLS					OLED_WIDTH									/*Total number of columns (horizontal pixels)*/
+	#define OLED_LAST_ROW					( OLED_HEIGHT - 1 )							/*Last row index in the display (bottommost pixel)*/
+	#define OLED_TOTAL_ROW					OLED_HEIGHT									/*Total number of rows (vertical pixels)*/
+	#define OLED_TOTAL_PAGES				( OLED_HEIGHT / OLED_PAGE_HEIGHT )			/*Total number of pages (each page contains 8 rows)*/
+	#define OLED_LAST_PAGE					( OLED_TOTAL_PAGES - 1 )					/*Last page index*/
+	#define OLED_TOTAL_PIXELS				( OLED_WIDTH * OLED_HEIGHT )				/*Total number of pixels in the display*/
+	#define OLED_TOTAL_BYTES				( OLED_TOTAL_COLS * OLED_TOTAL_PAGES )		/*Total number of bytes required to store the entire screen*/
+#endif
+
+/* 128x64 panels use the alternative COM pins configuration, shorter panels use the sequential one */
+#if OLED_HEIGHT == 64
+	#define OLED_COM_PINS					OLED_COM_PINS_ALT
+#else
+	#define OLED_COM_PINS					OLED_COM_PINS_SEQ
+#endif
+
+/* The SH1106 shows the 128 columns from the middle of its 132 RAM columns */
+#if OLED_CONTROLLER == OLED_CONTROLLER_SH1106
+	#define OLED_COL_OFFSET					OLED_SH1106_COL_OFFSET
+#else
+	#define OLED_COL_OFFSET					0
+#endif
+
+/* In console mode the cursor moves over all the RAM pages, the screen shows OLED_TOTAL_PAGES of them */
+#if OLED_CONSOLE_MODE == OLED_CONSOLE_ENABLE
+	#define OLED_CURSOR_PAGES				OLED_RAM_PAGES
+#else
+	#define OLED_CURSOR_PAGES				OLED_TOTAL_PAGES
+#endif
+
+/* The address and the cursor of a single panel are a constant and global variables, of multiple panels are read from the selected handle */
+#if OLED_PANELS_MODE == OLED_PANELS_SINGLE
+	#define OLED_ADDRESS					OLED_SLAVE_ADDRESS
+	#define OLED_CURSOR_PAGE				OLED_CurrentPage
+	#define OLED_CURSOR_COL					OLED_CurrentCol
+	#define OLED_CONSOLE_TOP_PAGE			OLED_ConsoleTopPage
+#elif OLED_PANELS_MODE == OLED_PANELS_MULTIPLE
+	#define OLED_ADDRESS					( OLED_ActiveDisplay->address )
+	#define OLED_CURSOR_PAGE				( OLED_ActiveDisplay->page )
+	#define OLED_CURSOR_COL					( OLED_ActiveDisplay->col )
+	#define OLED_CONSOLE_TOP_PAGE			( OLED_ActiveDisplay->topPage )
+#else
+	#error "Wrong \"OLED_PANELS_MODE\" configuration option"
+#endif
+
+#if	( OLED_CLK_DIVIDER > 0x0F ) || ( OLED_OSCIL_FREQ > 0x0F)
 	#error "the OLED_CLK_DIVIDER or OLED_OSCIL_FREQ value not in range"
 #else
 	#define OLED_CLK_DIV_OSCI_FREQ			(OLED_OSCIL_FREQ << 4) | (OLED_CLK_DIVIDER)
@@ -120,4 +243,39 @@
 	#error "the Multiplex Ratio value not in range"
 #endif
 
+#if OLED_TILES_MODE == OLED_TILES_ENABLE
+
+	#if ( OLED_WIDTH % OLED_TILE_SIZE ) != 0
+		#error "the tile engine requires an OLED_WIDTH that is a multiple of 8"
+	#elif ( OLED_SPRITES_NUM < 1 ) || ( OLED_SPRITES_NUM > 8 )
+		#error "the OLED_SPRITES_NUM value not in range"
+	#else
+		#define OLED_TILE_COLS				( OLED_TOTAL_COLS / OLED_TILE_SIZE )		/*Number of tile columns in the map (16 for 128 pixels)*/
+		#define OLED_TILE_ROWS				OLED_TOTAL_PAGES							/*Number of tile rows in the map (one per page)*/
+		#define OLED_TILES_ROW_MASK			( (uint16) ( ( 1UL << OLED_TILE_COLS ) - 1 ) )	/*Dirty bits of all the tiles of one map row*/
+	#endif
+
+#elif OLED_TILES_MODE != OLED_TILES_DISABLE
+	#error "Wrong \"OLED_TILES_MODE\" configuration option"
+#endif
+
+#if OLED_FRAMEBUFFER_MODE != OLED_FRAMEBUFFER_DISABLE
+
+	#if ( OLED_FRAMEBUFFER_FIRST_PAGE > OLED_FRAMEBUFFER_LAST_PAGE ) || ( OLED_FRAMEBUFFER_LAST_PAGE > OLED_LAST_PAGE )
+		#error "the OLED_FRAMEBUFFER_FIRST_PAGE or OLED_FRAMEBUFFER_LAST_PAGE value not in range"
+	#else
+		#define OLED_FRAMEBUFFER_PAGES		( OLED_FRAMEBUFFER_LAST_PAGE - OLED_FRAMEBUFFER_FIRST_PAGE + 1 )
+		#define OLED_FRAMEBUFFER_SIZE		( OLED_FRAMEBUFFER_PAGES * OLED_TOTAL_COLS )
+	#endif
+
+	#if OLED_MEMORY_MODE == OLED_MEMORY_MODE_VERTICAL
+		#error "the frame buffer requires OLED_MEMORY_MODE_HORIZONTAL or OLED_MEMORY_MODE_PAGE"
+	#endif
+
+	#if ( OLED_FRAMEBUFFER_MODE == OLED_FRAMEBUFFER_DOUBLE ) && ( 2 * OLED_FRAMEBUFFER_SIZE > OLED_FRAMEBUFFER_MAX_SIZE )
+		#error "the double frame buffer does not fit in SRAM, reduce the frame buffer pages"
+	#endif
+
+#endif
+
 #endif /* OLED_CONFIG_H_ */
@@ -27,25 +27,74 @@
 #define OLED_DEF_H_
 
 #include "../../LIB/STD_TYPES.h"
+#include "../../LIB/PGM_SPACE.h"
 
 
 /*------------------------------------------   macros    ----------------------------------------*/
 
-#define PROGMEM			__attribute__((__progmem__))	/*Attribute to store variables in program memory (Flash) instead of RAM*/
-
-/*Macro to read a byte from program memory (Flash) at the specified address*/
-#define pgm_read_byte(addr)				\
-(__extension__({						\
-    uint16 __addr16 = (uint16)(addr);	\
-    uint8 __result;						\
-    __asm__								\
-    (									\
-        "lpm %0, Z" "\n\t"				\
-        : "=r" (__result)				\
-        : "z" (__addr16)				\
-    );									\
-    __result;							\
-}))
+/*Pack the rows spanned by a sparkline column as ( low row << 8 ) | high row*/
+#define OLED_SPARKLINE_SPAN( A , B )		( ( ( A ) < ( B ) ) ? ( ( (uint16) ( A ) << 8 ) | ( B ) ) : ( ( (uint16) ( B ) << 8 ) | ( A ) ) )
+
+/*Check if a character is in the font table (printable ASCII) and not a newline character*/
+#define OLED_IS_PRINTABLE( CHAR )		( ( ( CHAR ) != '\n' ) && ( ( CHAR ) > 0x19 ) && ( ( ( CHAR ) - 0x20 ) < ( FontTableSize / OLED_FONT_SIZE ) ) )
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Structure to hold a scrolling sparkline chart (a ring buffer of samples, one per column)*/
+typedef struct {
+	uint8 * samples;						/*Ring buffer of scaled samples (rows from the chart bottom), must hold `width` bytes*/
+	sint16 min;								/*Sample value drawn at the chart bottom*/
+	sint16 max;								/*Sample value drawn at the chart top*/
+	uint8 page;								/*First (top) page of the chart*/
+	uint8 col;								/*First (left) column of the chart*/
+	uint8 width;							/*Number of columns (and samples) of the chart*/
+	uint8 pages;							/*Number of pages (height / 8) of the chart*/
+	uint8 head;								/*Ring buffer index of the oldest sample (drawn in the left column)*/
+}OLED_Sparkline;
+
+/*Structure to hold a horizontal or vertical bar graph*/
+typedef struct {
+	sint16 min;								/*Value of an empty bar*/
+	sint16 max;								/*Value of a full bar*/
+	uint8 direction;						/*Bar direction [ OLED_BAR_HORIZONTAL , OLED_BAR_VERTICAL ]*/
+	uint8 page;								/*First (top) page of the bar*/
+	uint8 col;								/*First (left) column of the bar*/
+	uint8 width;							/*Number of columns of the bar*/
+	uint8 pages;							/*Number of pages (height / 8) of the bar*/
+	uint8 level;							/*Filled columns (horizontal) or rows (vertical) currently drawn*/
+}OLED_Bar;
+
+/*Structure to hold a one page gauge with a pointer and min/max markers*/
+typedef struct {
+	sint16 min;								/*Value at the left end of the gauge*/
+	sint16 max;								/*Value at the right end of the gauge*/
+	uint8 page;								/*Page of the gauge*/
+	uint8 col;								/*First (left) column of the gauge*/
+	uint8 width;							/*Number of columns of the gauge*/
+	uint8 position;							/*Column of the pointer (current value)*/
+	uint8 minMarker;						/*Column of the lowest value since the last reset (OLED_GAUGE_NO_MARKER if none)*/
+	uint8 maxMarker;						/*Column of the highest value since the last reset (OLED_GAUGE_NO_MARKER if none)*/
+}OLED_Gauge;
+
+/*Structure to hold one OLED panel (used when OLED_PANELS_MODE is OLED_PANELS_MULTIPLE)*/
+typedef struct {
+	uint8 address;							/*7-bit I2C slave address of the panel*/
+	uint8 page;								/*Current cursor page of the panel*/
+	uint8 col;								/*Current cursor column of the panel*/
+	uint8 topPage;							/*Display RAM page shown at the top of the panel (console mode)*/
+}OLED_Display;
+
+/*Structure to hold one masked 8x8 sprite of the tile engine*/
+typedef struct {
+	const uint8 * image;					/*Sprite image in program memory (8 column bytes, LSB is the top pixel)*/
+	const uint8 * mask;						/*Sprite mask in program memory (8 column bytes, 1 where the image covers the tiles)*/
+	uint8 x;								/*Column of the sprite left edge in pixels*/
+	uint8 y;								/*Row of the sprite top edge in pixels*/
+	uint8 visible;							/*true if the sprite is drawn over the tiles*/
+}OLED_Sprite;
 /*_______________________________________________________________________________________________*/
 
 
@@ -54,6 +103,7 @@
 
 /*the OLED I2C Slave Address*/
 #define OLED_SLAVE_ADDRESS						0x3C	/*0x3C is the 7-bit address used for communication via I2C*/
+#define OLED_SLAVE_ADDRESS_ALT					0x3D	/*0x3D is the 7-bit address of a panel with the SA0 pin (D/C#) pulled high*/
 
 
 /*OLED Font Size*/
@@ -64,27 +114,52 @@
 #define OLED_SPACE_BYTE							0x00	/*Blank space byte (0x00) used for empty regions in character rendering*/
 
 
-/*SSD1306 Column Configuration*/
+/*OLED Column Configuration (the last column and the total columns depend on OLED_WIDTH, see OLED_config.h)*/
 #define OLED_FIRST_COL							0		/*First column index in the display (leftmost pixel)*/
-#define OLED_LAST_COL							127		/*Last column index in the display (rightmost pixel)*/
-#define OLED_TOTAL_COLS							128		/*Total number of columns (horizontal pixels)*/
 
 
-/*SSD1306 Row Configuration*/
+/*OLED Row Configuration (the last row and the total rows depend on OLED_HEIGHT, see OLED_config.h)*/
 #define OLED_FIRST_ROW							0		/*First row index in the display (topmost pixel)*/
-#define OLED_LAST_ROW							63		/*Last row index in the display (bottommost pixel)*/
-#define OLED_TOTAL_ROW							64		/*Total number of rows (vertical pixels)*/
 
 
-/*SSD1306 Page Configuration*/
+/*OLED Page Configuration (the last page and the total pages depend on OLED_HEIGHT, see OLED_config.h)*/
 #define OLED_FIRST_PAGE							0		/*First page index (Page 0: Rows 0 - 7)*/
-#define OLED_LAST_PAGE							7		/*Last page index (Page 7: Rows 56 - 63)*/
-#define OLED_TOTAL_PAGES						8		/*Total number of pages (each page contains 8 rows)*/
+#define OLED_PAGE_HEIGHT						8		/*Number of rows (vertical pixels) in one page*/
+#define OLED_RAM_PAGES							8		/*Number of pages in the controller RAM (SSD1306 and SH1106), even for panels with fewer rows*/
+
+
+/*SH1106 Column Offset*/
+#define OLED_SH1106_COL_OFFSET					2		/*The SH1106 has 132 RAM columns, the 128 visible columns start at RAM column 2*/
+
+
+/*OLED Frame Buffer Memory*/
+#define OLED_FRAMEBUFFER_MAX_SIZE				1024	/*Maximum SRAM bytes used by all the frame buffers (half of the ATmega32 2KB SRAM)*/
+
+
+/*OLED Widgets Column Bytes*/
+#define OLED_BAR_FILLED_BYTE					0xFF	/*Column byte of the filled part of a bar*/
+#define OLED_BAR_BORDER_BYTE					0xFF	/*Column byte of the left and right borders of a vertical bar*/
+#define OLED_BAR_TOP_BORDER_BYTE				0x01	/*Column byte of the top border of the empty part of a horizontal bar*/
+#define OLED_BAR_BOTTOM_BORDER_BYTE				0x80	/*Column byte of the bottom border of the empty part of a horizontal bar*/
+#define OLED_GAUGE_SCALE_BYTE					0x80	/*Column byte of the gauge scale line (bottom row)*/
+#define OLED_GAUGE_POINTER_BYTE					0x3F	/*Column byte of the gauge pointer (current value)*/
+#define OLED_GAUGE_MARKER_BYTE					0x60	/*Column byte of the gauge min and max markers*/
+#define OLED_GAUGE_NO_MARKER					0xFF	/*Marker column value when no value was set since the last reset*/
+
+
+/*OLED Bar Direction*/
+#define OLED_BAR_HORIZONTAL						0		/*Bar filled from left to right*/
+#define OLED_BAR_VERTICAL						1		/*Bar filled from bottom to top*/
 
 
-/*SSD1306 Display Memory*/
-#define OLED_TOTAL_PIXELS						8192	/*Total number of pixels in the display (128 × 64)*/
-#define OLED_TOTAL_BYTES						1024	/*Total number of bytes required to store the entire screen (128 × 64 ÷ 8)*/
+/*OLED Tile Engine*/
+#define OLED_TILE_SIZE							8		/*Width and height of a tile and a sprite in pixels (one tile is 8 column bytes of one page)*/
+
+
+/*OLED Pixel Colors*/
+#define OLED_PIXEL_OFF							0		/*Turn the pixel off*/
+#define OLED_PIXEL_ON							1		/*Turn the pixel on*/
+#define OLED_PIXEL_INVERT						2		/*Invert the current state of the pixel*/
 
 
 /*SSD1306 Scrolling Direction*/
@@ -204,6 +279,38 @@
 #define OLED_CHARGE_PUMP						0x8D	/*Double byte command to enable or disable charge pump regulator*/
 #define OLED_CHARGE_PUMP_ENABLE					0x14	/*Enable charge pump*/
 #define OLED_CHARGE_PUMP_DISABLE				0x10	/*Disable charge pump*/
+
+
+/*SH1106 DC-DC Converter Command*/
+#define OLED_SH1106_SET_DCDC					0xAD	/*Double byte command to turn the SH1106 DC-DC converter on or off (replaces the SSD1306 charge pump)*/
+#define OLED_SH1106_DCDC_ON						0x8B	/*Turn on the DC-DC converter*/
+#define OLED_SH1106_DCDC_OFF					0x8A	/*Turn off the DC-DC converter*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*OLED Controller*/
+#define OLED_CONTROLLER_SSD1306					0		/*SSD1306: 128 RAM columns, horizontal/vertical/page addressing and hardware scrolling*/
+#define OLED_CONTROLLER_SH1106					1		/*SH1106: 132 RAM columns (2 columns offset), page addressing only, no hardware scrolling*/
+
+/*OLED Panels Mode*/
+#define OLED_PANELS_SINGLE						0		/*One panel, the address and the cursor are constants and global variables*/
+#define OLED_PANELS_MULTIPLE					1		/*Several panels on the same bus, each one has an OLED_Display handle selected by OLED_SelectDisplay*/
+
+/*OLED Text Console Mode*/
+#define OLED_CONSOLE_DISABLE					0		/*Moving to the next line from the last page wraps around to the first page*/
+#define OLED_CONSOLE_ENABLE						1		/*Moving to the next line from the last visible page scrolls the text up one page using the display start line register*/
+
+/*OLED Frame Buffer Mode*/
+#define OLED_FRAMEBUFFER_DISABLE				0		/*No frame buffer, all functions write directly to the display*/
+#define OLED_FRAMEBUFFER_SINGLE					1		/*One SRAM frame buffer, copied to the display by a blocking I2C transfer*/
+#define OLED_FRAMEBUFFER_DOUBLE					2		/*Two SRAM frame buffers, the front buffer is streamed by the I2C interrupt while drawing into the back buffer*/
+
+/*OLED Tile Engine Mode*/
+#define OLED_TILES_DISABLE						0		/*No tile engine*/
+#define OLED_TILES_ENABLE						1		/*Tile map and masked sprites, only the changed (dirty) tiles are sent to the display*/
 /*_______________________________________________________________________________________________*/
 
 
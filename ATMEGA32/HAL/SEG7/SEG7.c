@@ -28,6 +28,22 @@
 static const uint8 SEG7_DigitArray[10] = SEG7_ARRAY;
 
 
+#if SEG7_REFRESH_MODE == SEG7_REFRESH_ENABLE
+
+/* Display Refreshed by the Timer Interrupt */
+Seg7 SEG7_RefreshSegments;
+
+
+/* Segment Buffer, the Data Port Value of each Digit */
+volatile uint8 SEG7_Buffer[ SEG7_REFRESH_MAX_DIGITS ];
+
+
+/* Lit and Dark Parts of each Digit Period and the Displayed Digit */
+MuxPhase SEG7_Phase;
+
+#endif
+
+
 
 
 
@@ -71,13 +87,11 @@ void SEG7_Multiplex_Init( Seg7 segments )
 	/* Check if the Last Control Pin Stays within Valid 0–7 pin Range */
 	if ( ( segments.FirstEnablePin + segments.DigitsNum - 1 ) <= 7 )
 	{
-		/* Loop on Control Pins to Initialize each Control Pin */
-		/* From First Pin (first_control_pin) to Last Pin (first_control_pin + seg7_digits_num - 1)*/
-		for(uint8 pin = segments.FirstEnablePin ; pin < segments.FirstEnablePin + segments.DigitsNum  ; pin++)
-		{
-			/* Initialize the Control Pin Direction as Output */
-			DIO_SetPinDirection( segments.EnablePort , pin , OUTPUT );
-		}
+		/* Group the Control Pins from First Pin (first_control_pin) to Last Pin (first_control_pin + seg7_digits_num - 1)*/
+		DIO_PinGroup control_pins = { segments.EnablePort , ( ( 1 << segments.DigitsNum ) - 1 ) << segments.FirstEnablePin };
+
+		/* Initialize All the Control Pins Direction as Output at Once */
+		DIO_SetPinGroupDirection( &control_pins , OUTPUT );
 
 		/* Initialization the Specified 7-Segment Port Direction */
 		DIO_SetPortDirection( segments.DataPort , OUTPUT_PORT );
@@ -133,13 +147,9 @@ void SEG7_Multiplex_Display( Seg7 segments , uint16 number )
 	/* Check if the Last Control Pin Stays within Valid 0–7 pin Range */
 	if ( ( segments.FirstEnablePin + segments.DigitsNum - 1 ) <= 7 )
 	{
-		/* Loop on Control Pins to Clear each Control Pin */
+		/* Clear All the Control Pins at Once */
 		/* From First Pin (first_control_pin) to Last Pin (first_control_pin + seg7_digits_num - 1)*/
-		for(uint8 pin = segments.FirstEnablePin ; pin < segments.FirstEnablePin + segments.DigitsNum  ; pin++)
-		{
-			/* Initialize the Control Pin Direction as Output */
-			DIO_SetPinValue( segments.EnablePort , pin , LOW );
-		}
+		DIO_ClearPins( segments.EnablePort , ( ( 1 << segments.DigitsNum ) - 1 ) << segments.FirstEnablePin );
 
 
 		/* Loop on each Digit */
@@ -222,3 +232,241 @@ void SEG7_EnableDot( uint8 seg7_port )
 
 
 
+
+#if SEG7_REFRESH_MODE == SEG7_REFRESH_ENABLE
+
+/*
+ * @brief Refreshes the display by one part of a digit period.
+ *
+ * Each digit period starts by turning the previous digit off and lighting the next digit
+ * from the segment buffer for its lit part, then the digit stays off for its dark part
+ * (the brightness, see MUX_PHASE). With SEG7_REFRESH_TIMER0 or 2 the driver calls this function from the
+ * timer interrupt. With SEG7_REFRESH_TIMER_MANUAL call it from your own timer compare
+ * interrupt and load the returned length minus 1 to the compare value (at full brightness
+ * a fixed periodic interrupt also works, one digit per call).
+ *
+ * @return Length of the part that starts, in timer ticks.
+ */
+uint8 SEG7_Refresh_Tick( void )
+{
+
+	uint8 ticks;
+
+
+	/* Turn the Current Digit Off (the Port Registers are Written Directly to Keep the Interrupt Short) */
+	DIO_SetPinValueFast( SEG7_RefreshSegments.EnablePort , SEG7_RefreshSegments.FirstEnablePin + SEG7_Phase.Line , SEG7_PIN_DISABLE );
+
+	/* Move to the Next Part of the Period */
+	ticks = MUX_PHASE_Next( & SEG7_Phase , SEG7_RefreshSegments.DigitsNum );
+
+	/* Output the Segments of the Digit and Light it */
+	if( SEG7_Phase.Lit == true )
+	{
+		DIO_PORT_REG( SEG7_RefreshSegments.DataPort ) = SEG7_Buffer[ SEG7_Phase.Line ];
+		DIO_SetPinValueFast( SEG7_RefreshSegments.EnablePort , SEG7_RefreshSegments.FirstEnablePin + SEG7_Phase.Line , SEG7_PIN_ENABLE );
+	}
+
+	return ticks;
+}
+
+
+
+
+
+#if SEG7_REFRESH_TIMER != SEG7_REFRESH_TIMER_MANUAL
+
+/*
+ * @brief Timer compare match handler that refreshes the display.
+ *
+ * This function is not intended for direct use by the user. It refreshes one part of the
+ * digit period and sets its length as the compare value.
+ */
+static void SEG7_RefreshInterrupt( void )
+{
+
+	/* Set the Length of this Part (the CTC Timer Counts from 0 to the Compare Value) */
+	#if   SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER0
+		TIMER0_SetCompareValue( SEG7_Refresh_Tick() - 1 );
+	#elif SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER2
+		TIMER2_SetCompareValue( SEG7_Refresh_Tick() - 1 );
+	#endif
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Initializes a multiplexed 7-segment display refreshed by a timer interrupt.
+ *
+ * This function initializes the pins like SEG7_Multiplex_Init(), blanks the segment buffer,
+ * sets the full brightness and sets the timer compare match callback. The display is then
+ * refreshed in the background, one digit per timer interrupt, and the application only
+ * updates the segment buffer with the SEG7_Refresh_ functions.
+ *
+ * @param segments   A structure of type `Seg7` containing:
+ *              	 - DataPort:	   Port connected to segment data lines (A to G, DP)
+ *      	         - EnablePort:	   Port connected to digit control pins
+ *          	     - FirstEnablePin: The first digit control pin (0–7)
+ *              	 - DigitsNum:	   Number of digits used in the display (1–8)
+ */
+void SEG7_Refresh_Init( Seg7 segments )
+{
+
+	/* Check if the Number of Digits Fits the Segment Buffer */
+	if( ( segments.DigitsNum == 0 ) || ( segments.DigitsNum > SEG7_REFRESH_MAX_DIGITS ) )
+	{
+		return;
+	}
+
+	/* Initialize the Pins */
+	SEG7_Multiplex_Init( segments );
+	SEG7_RefreshSegments = segments;
+
+	/* Blank the Segment Buffer */
+	for( uint8 position = 0 ; position < SEG7_REFRESH_MAX_DIGITS ; position++ )
+	{
+		SEG7_Buffer[ position ] = SEG7_DISABLE_msk;
+	}
+
+	SEG7_Refresh_SetBrightness( SEG7_BRIGHTNESS_MAX );
+
+	/* Set the Timer Compare Match Interrupt Callback to Refresh the Display */
+	#if   SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER0
+		TIMER0_SetCallback( TIMER0_COMP_ID , & SEG7_RefreshInterrupt );
+	#elif SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER2
+		TIMER2_SetCallback( TIMER2_COMP_ID , & SEG7_RefreshInterrupt );
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Shows a number on the refreshed display.
+ *
+ * The last digit shows the units and the first digit the highest digit, with leading zeros.
+ * The decimal points do not change.
+ *
+ * @param number: The numeric value to be displayed.
+ */
+void SEG7_Refresh_SetNumber( uint32 number )
+{
+
+	/* Loop on the Digits from the Units */
+	for( sint8 position = SEG7_RefreshSegments.DigitsNum - 1 ; position >= 0 ; position-- )
+	{
+		SEG7_Refresh_SetDigit( position , number % 10 );
+
+		/* To go to Next Digit */
+		number /= 10;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Shows a digit (0 to 9) at a position of the refreshed display.
+ *
+ * The decimal point of the position does not change.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param digit:    Digit to display (0 to 9).
+ */
+void SEG7_Refresh_SetDigit( uint8 position , uint8 digit )
+{
+
+	/* Check that the Position and the Digit are Valid */
+	if( ( position < SEG7_REFRESH_MAX_DIGITS ) && ( digit < 10 ) )
+	{
+		/* Keep the Decimal Point of the Position */
+		SEG7_Buffer[ position ] = ( SEG7_DigitArray[ digit ] & ~( 1 << SEG7_DOT_PIN ) ) | ( SEG7_Buffer[ position ] & ( 1 << SEG7_DOT_PIN ) );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Shows a raw segment pattern at a position of the refreshed display.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param pattern:  Lit segments, bit 0 to 6 for segments A to G and bit 7 for the
+ *                  decimal point (1 lights the segment for both display types).
+ */
+void SEG7_Refresh_SetRaw( uint8 position , uint8 pattern )
+{
+
+	/* Check that the Position is Valid */
+	if( position < SEG7_REFRESH_MAX_DIGITS )
+	{
+		/* Convert the Lit Segments to the Data Port Value (Inverted for Common Anode) */
+		SEG7_Buffer[ position ] = pattern ^ SEG7_DISABLE_msk;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Turns the decimal point of a position of the refreshed display on or off.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param status:   true to light the decimal point, false to turn it off.
+ */
+void SEG7_Refresh_SetDot( uint8 position , uint8 status )
+{
+
+	/* Check that the Position is Valid */
+	if( position < SEG7_REFRESH_MAX_DIGITS )
+	{
+		/* The Dot is Lit when its Bit Differs from the Disable Mask */
+		if( status ^ GET_BIT( SEG7_DISABLE_msk , SEG7_DOT_PIN ) )
+		{
+			SET_BIT( SEG7_Buffer[ position ] , SEG7_DOT_PIN );
+		}
+		else
+		{
+			CLR_BIT( SEG7_Buffer[ position ] , SEG7_DOT_PIN );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets the brightness of the refreshed display.
+ *
+ * Each digit is lit for a part of its period, from 0 (off) to SEG7_BRIGHTNESS_MAX (the whole period).
+ *
+ * @param level: Brightness level (0 to SEG7_BRIGHTNESS_MAX).
+ */
+void SEG7_Refresh_SetBrightness( uint8 level )
+{
+
+	uint8 on_ticks;
+	uint8 off_ticks;
+
+	/* Split the Digit Period to the Lit and Dark Parts */
+	MUX_PHASE_Split( SEG7_DIGIT_PERIOD_TICKS , SEG7_MIN_PHASE_TICKS , level , SEG7_BRIGHTNESS_MAX , & on_ticks , & off_ticks );
+
+	/* Update Both Parts Together for the Interrupt */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	SEG7_Phase.OnTicks  = on_ticks;
+	SEG7_Phase.OffTicks = off_ticks;
+
+	SREG = sreg;
+}
+
+#endif
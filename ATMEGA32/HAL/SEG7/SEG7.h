@@ -17,6 +17,8 @@
  * - Multiplexed display of multi-digit numbers.
  * - Dot LED control (enable/disable).
  * - Segment disabling for power-saving or blanking.
+ * - Background refresh from a timer interrupt with a segment buffer, brightness control,
+ *   per-digit decimal points and raw segment patterns (SEG7_REFRESH_ENABLE).
  *
  * @note
  * - Requires `SEG7_config.h` for macro-based configuration.
@@ -32,6 +34,7 @@
 #define SEG7_H_
 
 #include "../../LIB/STD_TYPES.h"
+#include "../../LIB/MUX_PHASE/MUX_PHASE.h"
 #include "../SEG7/SEG7_config.h"
 #include <util/delay.h>
 
@@ -130,4 +133,92 @@ void SEG7_DisableDot( uint8 seg7_port );
 void SEG7_EnableDot( uint8 seg7_port );
 
 
+#if SEG7_REFRESH_MODE == SEG7_REFRESH_ENABLE
+
+
+/*
+ * @brief Initializes a multiplexed 7-segment display refreshed by a timer interrupt.
+ *
+ * This function initializes the pins like SEG7_Multiplex_Init(), blanks the segment buffer,
+ * sets the full brightness and sets the timer compare match callback. The display is then
+ * refreshed in the background, one digit per timer interrupt, and the application only
+ * updates the segment buffer with the SEG7_Refresh_ functions.
+ *
+ * @param segments   A structure of type `Seg7` containing:
+ *              	 - DataPort:	   Port connected to segment data lines (A to G, DP)
+ *      	         - EnablePort:	   Port connected to digit control pins
+ *          	     - FirstEnablePin: The first digit control pin (0–7)
+ *              	 - DigitsNum:	   Number of digits used in the display (1–8)
+ */
+void SEG7_Refresh_Init( Seg7 segments );
+
+
+/*
+ * @brief Shows a number on the refreshed display.
+ *
+ * The last digit shows the units and the first digit the highest digit, with leading zeros.
+ * The decimal points do not change.
+ *
+ * @param number: The numeric value to be displayed.
+ */
+void SEG7_Refresh_SetNumber( uint32 number );
+
+
+/*
+ * @brief Shows a digit (0 to 9) at a position of the refreshed display.
+ *
+ * The decimal point of the position does not change.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param digit:    Digit to display (0 to 9).
+ */
+void SEG7_Refresh_SetDigit( uint8 position , uint8 digit );
+
+
+/*
+ * @brief Shows a raw segment pattern at a position of the refreshed display.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param pattern:  Lit segments, bit 0 to 6 for segments A to G and bit 7 for the
+ *                  decimal point (1 lights the segment for both display types).
+ */
+void SEG7_Refresh_SetRaw( uint8 position , uint8 pattern );
+
+
+/*
+ * @brief Turns the decimal point of a position of the refreshed display on or off.
+ *
+ * @param position: Digit position (0 is the digit on FirstEnablePin).
+ * @param status:   true to light the decimal point, false to turn it off.
+ */
+void SEG7_Refresh_SetDot( uint8 position , uint8 status );
+
+
+/*
+ * @brief Sets the brightness of the refreshed display.
+ *
+ * Each digit is lit for a part of its period, from 0 (off) to SEG7_BRIGHTNESS_MAX (the whole period).
+ *
+ * @param level: Brightness level (0 to SEG7_BRIGHTNESS_MAX).
+ */
+void SEG7_Refresh_SetBrightness( uint8 level );
+
+
+/*
+ * @brief Refreshes the display by one part of a digit period.
+ *
+ * Each digit period starts by turning the previous digit off and lighting the next digit
+ * from the segment buffer for its lit part, then the digit stays off for its dark part
+ * (the brightness, see MUX_PHASE). With SEG7_REFRESH_TIMER0 or 2 the driver calls this function from the
+ * timer interrupt. With SEG7_REFRESH_TIMER_MANUAL call it from your own timer compare
+ * interrupt and load the returned length minus 1 to the compare value (at full brightness
+ * a fixed periodic interrupt also works, one digit per call).
+ *
+ * @return Length of the part that starts, in timer ticks.
+ */
+uint8 SEG7_Refresh_Tick( void );
+
+#endif
+
+
 #endif /* SEG7_H_ */
@@ -38,6 +38,37 @@
 #define SEG7_MULTIPLEX_DELAY				5
 
 
+/*Set the Background Refresh Mode
+ * choose between:
+ * 1. SEG7_REFRESH_DISABLE					<--the default (SEG7_Multiplex_Display blocks while it multiplexes)
+ * 2. SEG7_REFRESH_ENABLE					(SEG7_Refresh_ functions update a buffer that a timer interrupt displays)
+ */
+#define SEG7_REFRESH_MODE					SEG7_REFRESH_DISABLE
+
+
+/*Set the Timer that Refreshes the Display (used only with SEG7_REFRESH_ENABLE)
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled,
+ * the driver sets the compare value
+ * choose between:
+ * 1. SEG7_REFRESH_TIMER_MANUAL				(call SEG7_Refresh_Tick() from your own timer interrupt)
+ * 2. SEG7_REFRESH_TIMER0
+ * 3. SEG7_REFRESH_TIMER2					<--the most used
+ */
+#define SEG7_REFRESH_TIMER					SEG7_REFRESH_TIMER2
+
+
+/*Set the Prescaler of your own Timer (used only with SEG7_REFRESH_TIMER_MANUAL)
+ * SEG7_Refresh_Tick() returns the length of each part in ticks of this prescaler
+ */
+#define SEG7_MANUAL_PRESCALER				64
+
+
+/*Set the Time each Digit is Selected in us (used only with SEG7_REFRESH_ENABLE)
+ * Must be between 16 and 255 timer ticks, the brightness is the lit part of this time
+ */
+#define SEG7_DIGIT_PERIOD_US				2000	//<--the most used 2000 (with 4 digits: 125 Hz refresh)
+
+
 /******* Automatically Set *******/
 #if   SEG7_TYPE == SEG7_COMMON_ANODE
 
@@ -74,4 +105,90 @@
 
 
 
+/* Error checking for invalid configurations */
+#if SEG7_REFRESH_MODE == SEG7_REFRESH_ENABLE
+
+	#ifndef F_CPU
+		#define F_CPU 8000000UL
+		#warning "F_CPU not defined! Assuming 8MHz."
+	#endif
+
+	#if   SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER0
+
+		#include "../../MCAL/TIMER0/TIMER0.h"
+
+		/* You must initialize Timer0 manually "TIMER0_Init()" before using the background refresh */
+		#ifndef TIMER0_IN_HAL
+		#define TIMER0_IN_HAL
+			#warning "⚠️ Initialize Timer0 manually before using the 7-segment background refresh."
+		#endif
+
+		/* Only one driver can use the Timer0 compare match */
+		#ifdef TIMER0_COMP_CLAIMED
+			#error "The Timer0 compare match is used by another driver, change SEG7_REFRESH_TIMER"
+		#endif
+		#define TIMER0_COMP_CLAIMED
+
+		/* Configure Timer0 to CTC mode */
+		#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+			#warning "⚠️ Configure Timer0 in CTC mode."
+		#endif
+
+		/* Enable Timer0 compare match interrupt */
+		#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer0 compare match interrupt."
+		#endif
+
+		/*Timer ticks of one digit period*/
+		#define SEG7_DIGIT_PERIOD_TICKS		( ( SEG7_DIGIT_PERIOD_US * ( F_CPU / 1000000UL ) ) / TIMER0_PRESCALER )
+
+	#elif SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER2
+
+		#include "../../MCAL/TIMER2/TIMER2.h"
+
+		/* You must initialize Timer2 manually "TIMER2_Init()" before using the background refresh */
+		#ifndef TIMER2_IN_HAL
+		#define TIMER2_IN_HAL
+			#warning "⚠️ Initialize Timer2 manually before using the 7-segment background refresh."
+		#endif
+
+		/* Only one driver can use the Timer2 compare match */
+		#ifdef TIMER2_COMP_CLAIMED
+			#error "The Timer2 compare match is used by another driver, change SEG7_REFRESH_TIMER"
+		#endif
+		#define TIMER2_COMP_CLAIMED
+
+		/* Configure Timer2 to CTC mode */
+		#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+			#warning "⚠️ Configure Timer2 in CTC mode."
+		#endif
+
+		/* Enable Timer2 compare match interrupt */
+		#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+			#warning "⚠️ Enable Timer2 compare match interrupt."
+		#endif
+
+		/*Timer ticks of one digit period*/
+		#define SEG7_DIGIT_PERIOD_TICKS		( ( SEG7_DIGIT_PERIOD_US * ( F_CPU / 1000000UL ) ) / TIMER2_PRESCALER )
+
+	#elif SEG7_REFRESH_TIMER == SEG7_REFRESH_TIMER_MANUAL
+
+		/*Timer ticks of one digit period*/
+		#define SEG7_DIGIT_PERIOD_TICKS		( ( SEG7_DIGIT_PERIOD_US * ( F_CPU / 1000000UL ) ) / SEG7_MANUAL_PRESCALER )
+
+	#else
+		#error "Wrong \"SEG7_REFRESH_TIMER\" configuration option"
+	#endif
+
+	/*Check if the digit period fits the 8-bit timer*/
+	#if ( SEG7_DIGIT_PERIOD_TICKS < 16 ) || ( SEG7_DIGIT_PERIOD_TICKS > 255 )
+		#error "SEG7_DIGIT_PERIOD_US is not between 16 and 255 timer ticks, change it or the timer prescaler"
+	#endif
+
+#elif SEG7_REFRESH_MODE != SEG7_REFRESH_DISABLE
+	#error "Wrong \"SEG7_REFRESH_MODE\" configuration option"
+#endif
+
+
+
 #endif /* SEG7_CONFIG_H_ */
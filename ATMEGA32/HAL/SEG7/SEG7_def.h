@@ -41,6 +41,16 @@ typedef struct{
 
 #define SEG7_DOT_PIN						7		/* Pin for the decimal point(dot) on the 7-segment display */
 
+/*Timers that Refresh the Display*/
+#define SEG7_REFRESH_TIMER_MANUAL			0		/*SEG7_Refresh_Tick() is called by the user from their own timer interrupt*/
+#define SEG7_REFRESH_TIMER0					1		/*Timer0 compare match interrupt refreshes the display*/
+#define SEG7_REFRESH_TIMER2					2		/*Timer2 compare match interrupt refreshes the display*/
+
+/*Background Refresh Limits*/
+#define SEG7_REFRESH_MAX_DIGITS				8		/*Maximum number of digits in the segment buffer*/
+#define SEG7_BRIGHTNESS_MAX					16		/*Full brightness level (0 turns the display off)*/
+#define SEG7_MIN_PHASE_TICKS				8		/*Shortest on or off time in timer ticks (longer than the interrupt)*/
+
 /*7-Segment Common Anode Logic*/
 #define SEG7_ANODE_PIN_ENABLE				HIGH	/*Set pin LOW to enable (turn on) the Segment(LED) for Common Anode*/
 #define SEG7_ANODE_PIN_DISABLE				LOW		/*Set pin HIGH to disable (turn off) the Segment(LED) for Common Anode*/
@@ -83,6 +93,10 @@ typedef struct{
 /*7-Segment Type*/
 #define SEG7_COMMON_ANODE					0	/*Common Anode:   Segments light up when the corresponding pin is set LOW*/
 #define SEG7_COMMON_CATHODE					1	/*Common Cathode: Segments light up when the corresponding pin is set HIGH*/
+
+/*7-Segment Background Refresh Mode*/
+#define SEG7_REFRESH_DISABLE				0	/*The application multiplexes the digits with SEG7_Multiplex_Display()*/
+#define SEG7_REFRESH_ENABLE					1	/*A timer compare match interrupt lights one digit per tick from the segment buffer*/
 /*_______________________________________________________________________________________________*/
 
 
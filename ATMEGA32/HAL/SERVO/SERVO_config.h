@@ -37,6 +37,12 @@
 	#warning "⚠️ Initialize Timer1 manually before using this driver."
 #endif
 
+/* Only one driver can use the Timer1 compare match B */
+#ifdef TIMER1_COMPB_CLAIMED
+	#error "The Timer1 compare match B is used by another driver, the servo driver needs it"
+#endif
+#define TIMER1_COMPB_CLAIMED
+
 
 /* Configure Timer1 to Normal mode */
 #if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_NORMAL_MODE
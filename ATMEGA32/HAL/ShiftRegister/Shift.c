@@ -49,14 +49,21 @@
 void SHIFT_OUT_Init(void)
 {
 	/* Set the Pins Direction as Output */
-	DIO_SetPinDirection(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, OUTPUT);
 	DIO_SetPinDirection(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, OUTPUT);
-	DIO_SetPinDirection(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, OUTPUT);
 
 	/* set the Pins as Low Value */
-	DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, LOW);
 	DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, LOW);
-	DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, LOW);
+
+	/* The SPI Drives the Clock and Data Pins in SHIFT_INTERFACE_SPI */
+	#if SHIFT_INTERFACE == SHIFT_INTERFACE_DIO
+
+		DIO_SetPinDirection(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, OUTPUT);
+		DIO_SetPinDirection(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, OUTPUT);
+
+		DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, LOW);
+		DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, LOW);
+
+	#endif
 }
 
 
@@ -73,15 +80,22 @@ void SHIFT_OUT_Init(void)
 void SHIFT_IN_Init(void)
 {
 	/* Set the Pins Direction as Output */
-	DIO_SetPinDirection(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, OUTPUT);
 	DIO_SetPinDirection(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, OUTPUT);
 
-	/* Set the Pin Direction as Input */
-	DIO_SetPinDirection(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN, INPUT);
-
 	/* set the Pins as Low Value */
-	DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, LOW);
 	DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, LOW);
+
+	/* The SPI Drives the Clock and Data Pins in SHIFT_INTERFACE_SPI */
+	#if SHIFT_INTERFACE == SHIFT_INTERFACE_DIO
+
+		DIO_SetPinDirection(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, OUTPUT);
+
+		/* Set the Pin Direction as Input */
+		DIO_SetPinDirection(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN, INPUT);
+
+		DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, LOW);
+
+	#endif
 }
 
 
@@ -99,6 +113,13 @@ void SHIFT_IN_Init(void)
 void SHIFT_OUT_Byte(uint8 data)
 {
 
+	#if SHIFT_INTERFACE == SHIFT_INTERFACE_SPI
+
+	/* Shift the Byte with the Hardware SPI (the Bit Order is SPI_DATA_ORDER) */
+	SPI_TransmitByte(data);
+
+	#else
+
 	/* Loop through each bit in the byte */
 	for (uint8 bit_num = 0; bit_num < 8; bit_num++)
 	{
@@ -107,7 +128,7 @@ void SHIFT_OUT_Byte(uint8 data)
 		#if   SHIFT_ORDER == SHIFT_LSB_FIRST
 
 			/* Write the Shifted-out bit (least significant bit first) */
-			DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, GET_BIT(data, 0));
+			DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, GET_BIT(data, 0));
 
 			/* Get the next bit */
 			data >>= 1;
@@ -115,7 +136,7 @@ void SHIFT_OUT_Byte(uint8 data)
 		#elif SHIFT_ORDER == SHIFT_MSB_FIRST
 
 			/* Write the Shifted-out bit (most significant bit first) */
-			DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, GET_BIT(data, 7));
+			DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_DATA_PIN, GET_BIT(data, 7));
 
 			/* Get the next bit */
 			data <<= 1;
@@ -125,13 +146,15 @@ void SHIFT_OUT_Byte(uint8 data)
 		#endif
 
 		/* Pulse the clock pin to shift the next bit into the register */
-		DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, HIGH);
-		_delay_us(5);
+		DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, HIGH);
+		_delay_us(SHIFT_PULSE_DELAY);
 
 		/* Pulse the clock pin low to complete the bit shift */
-		DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, LOW);
-		_delay_us(5);
+		DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_CLOCK_PIN, LOW);
+		_delay_us(SHIFT_PULSE_DELAY);
 	}
+
+	#endif
 }
 
 
@@ -148,6 +171,14 @@ void SHIFT_OUT_Byte(uint8 data)
  */
 uint8 SHIFT_IN_Byte(void)
 {
+
+	#if SHIFT_INTERFACE == SHIFT_INTERFACE_SPI
+
+	/* Shift the Byte with the Hardware SPI (the Bit Order is SPI_DATA_ORDER) */
+	return SPI_ReceiveByte();
+
+	#else
+
 	uint8 data = 0;
 
 	/* Loop through each bit in the byte */
@@ -158,27 +189,29 @@ uint8 SHIFT_IN_Byte(void)
 		#if   SHIFT_ORDER == SHIFT_LSB_FIRST
 
 			/* Read the Shifted-in bit (least significant bit first) */
-			data |= DIO_GetPinValue(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN) << bit_num;
+			data |= DIO_GetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN) << bit_num;
 
 		#elif SHIFT_ORDER == SHIFT_MSB_FIRST
 
 			/* Read the Shifted-in bit (most significant bit first) */
-			data |= DIO_GetPinValue(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN) << (7 - bit_num);
+			data |= DIO_GetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_DATA_PIN) << (7 - bit_num);
 		#else
 			/* Make an Error */
 			#error "Wrong \"SHIFT_ORDER\" configuration option"
 		#endif
 
 		/* Pulse the clock pin to shift the next bit into the register */
-		DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, HIGH);
-		_delay_us(5);
+		DIO_SetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, HIGH);
+		_delay_us(SHIFT_PULSE_DELAY);
 
 		/* Pulse the clock pin low to complete the bit shift */
-		DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, LOW);
-		_delay_us(5);
+		DIO_SetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_CLOCK_PIN, LOW);
+		_delay_us(SHIFT_PULSE_DELAY);
 	}
 
 	return data;
+
+	#endif
 }
 
 
@@ -194,12 +227,12 @@ uint8 SHIFT_IN_Byte(void)
 void SHIFT_OUT_Latch(void)
 {
 	/* Enable the Latch by Setting the Load pin High */
-	DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, HIGH);
+	DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, HIGH);
 
-	_delay_us(5);
+	_delay_us(SHIFT_PULSE_DELAY);
 
 	/* Disable the Latch by Setting the Load pin Low */
-	DIO_SetPinValue(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, LOW);
+	DIO_SetPinValueFast(SHIFT_OUT_PORT, SHIFT_OUT_LOAD_PIN, LOW);
 }
 
 
@@ -216,13 +249,341 @@ void SHIFT_IN_Latch(void)
 {
 
 	/* Enable the Latch by Setting the Load pin Low */
-	DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, LOW);
+	DIO_SetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, LOW);
 
-	_delay_us(5);
+	_delay_us(SHIFT_PULSE_DELAY);
 
 	/* Disable the Latch by Setting the Load pin High */
-	DIO_SetPinValue(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, HIGH);
+	DIO_SetPinValueFast(SHIFT_IN_PORT, SHIFT_IN_LOAD_PIN, HIGH);
+}
+
+
+
+
+
+/* Shadow Image of the 74HC595 Chain Outputs and its Change Mark */
+#if SHIFT_OUT_CHAIN_LENGTH > 0
+volatile uint8 SHIFT_CHAIN_OutputImage[SHIFT_OUT_CHAIN_LENGTH];
+volatile uint8 SHIFT_CHAIN_OutputChanged = false;
+#endif
+
+
+/* Image of the 74HC165 Chain Inputs and the Inputs Changed since the Last SHIFT_CHAIN_GetInputs() */
+#if SHIFT_IN_CHAIN_LENGTH > 0
+volatile uint8 SHIFT_CHAIN_InputImage[SHIFT_IN_CHAIN_LENGTH];
+volatile uint8 SHIFT_CHAIN_InputChanges[SHIFT_IN_CHAIN_LENGTH];
+#endif
+
+
+
+
+
+/*
+ * @brief Initializes the shift register chains.
+ *
+ * This function initializes the pins of the used chains, clears all the outputs,
+ * takes the first input snapshot (without changes) and sets the timer callback.
+ */
+void SHIFT_CHAIN_Init(void)
+{
+
+	#if SHIFT_OUT_CHAIN_LENGTH > 0
+
+		SHIFT_OUT_Init();
+
+		/* Clear All the Outputs */
+		for (uint8 reg = 0; reg < SHIFT_OUT_CHAIN_LENGTH; reg++)
+		{
+			SHIFT_CHAIN_OutputImage[reg] = 0;
+		}
+
+		SHIFT_CHAIN_OutputChanged = true;
+		SHIFT_CHAIN_Flush();
+
+	#endif
+
+	#if SHIFT_IN_CHAIN_LENGTH > 0
+
+		SHIFT_IN_Init();
+
+		/* Take the First Snapshot and Forget its Changes */
+		SHIFT_CHAIN_Snapshot();
+
+		for (uint8 reg = 0; reg < SHIFT_IN_CHAIN_LENGTH; reg++)
+		{
+			SHIFT_CHAIN_InputChanges[reg] = 0;
+		}
+
+	#endif
+
+	/* Set the Timer Compare Match Interrupt Callback to Refresh the Chains */
+	#if   SHIFT_CHAIN_TIMER == SHIFT_CHAIN_TIMER0
+		TIMER0_SetCallback(TIMER0_COMP_ID, &SHIFT_CHAIN_Refresh);
+	#elif SHIFT_CHAIN_TIMER == SHIFT_CHAIN_TIMER2
+		TIMER2_SetCallback(TIMER2_COMP_ID, &SHIFT_CHAIN_Refresh);
+	#endif
 }
 
 
 
+
+
+/*
+ * @brief Sets an output of the 74HC595 chain to HIGH in the shadow image.
+ *
+ * The output pin changes at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param output: Output number ( register * 8 + bit ).
+ */
+void SHIFT_CHAIN_SetOutput(uint8 output)
+{
+
+	#if SHIFT_OUT_CHAIN_LENGTH > 0
+
+	/* Check that the Output Number is Valid */
+	if (output < SHIFT_OUT_CHAIN_LENGTH * 8)
+	{
+		SET_BIT(SHIFT_CHAIN_OutputImage[output >> 3], output & 7);
+
+		/* Mark the Image after Changing it */
+		SHIFT_CHAIN_OutputChanged = true;
+	}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Clears an output of the 74HC595 chain to LOW in the shadow image.
+ *
+ * The output pin changes at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param output: Output number ( register * 8 + bit ).
+ */
+void SHIFT_CHAIN_ClearOutput(uint8 output)
+{
+
+	#if SHIFT_OUT_CHAIN_LENGTH > 0
+
+	/* Check that the Output Number is Valid */
+	if (output < SHIFT_OUT_CHAIN_LENGTH * 8)
+	{
+		CLR_BIT(SHIFT_CHAIN_OutputImage[output >> 3], output & 7);
+
+		/* Mark the Image after Changing it */
+		SHIFT_CHAIN_OutputChanged = true;
+	}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Writes all the outputs of one 74HC595 of the chain in the shadow image.
+ *
+ * The output pins change at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param reg:   Register number in the chain (0 is the one connected to the MCU).
+ * @param value: Value of the register outputs.
+ */
+void SHIFT_CHAIN_WriteByte(uint8 reg, uint8 value)
+{
+
+	#if SHIFT_OUT_CHAIN_LENGTH > 0
+
+	/* Check that the Register Number is Valid */
+	if (reg < SHIFT_OUT_CHAIN_LENGTH)
+	{
+		SHIFT_CHAIN_OutputImage[reg] = value;
+
+		/* Mark the Image after Changing it */
+		SHIFT_CHAIN_OutputChanged = true;
+	}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Shifts the shadow image to the 74HC595 chain and latches it once.
+ *
+ * Nothing is shifted if the image did not change since the last flush.
+ *
+ * @return (uint8) true if the image was shifted, false if nothing changed.
+ */
+uint8 SHIFT_CHAIN_Flush(void)
+{
+
+	#if SHIFT_OUT_CHAIN_LENGTH > 0
+
+	/* Check if the Image Changed since the Last Flush */
+	if (SHIFT_CHAIN_OutputChanged == false)
+	{
+		return false;
+	}
+
+	/* Clear the Mark before Reading the Image, so a Change Made while Shifting is Flushed Next Time */
+	SHIFT_CHAIN_OutputChanged = false;
+
+	/* Shift the Last Register First, so Register 0 Ends Next to the MCU */
+	for (uint8 reg = SHIFT_OUT_CHAIN_LENGTH; reg > 0; reg--)
+	{
+		SHIFT_OUT_Byte(SHIFT_CHAIN_OutputImage[reg - 1]);
+	}
+
+	/* Latch All the Outputs at Once */
+	SHIFT_OUT_Latch();
+
+	return true;
+
+	#else
+
+	return false;
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Reads all the inputs of the 74HC165 chain at the same time.
+ *
+ * The inputs are latched once and shifted into the input image, and the inputs that
+ * changed since the previous snapshot are added to the changes read by SHIFT_CHAIN_GetInputs().
+ *
+ * @return (uint8) true if any input changed, false otherwise.
+ */
+uint8 SHIFT_CHAIN_Snapshot(void)
+{
+
+	uint8 changed = false;
+
+	#if SHIFT_IN_CHAIN_LENGTH > 0
+
+	uint8 value;
+
+	/* Load All the Inputs at Once */
+	SHIFT_IN_Latch();
+
+	/* Register 0 (Next to the MCU) is Shifted In First */
+	for (uint8 reg = 0; reg < SHIFT_IN_CHAIN_LENGTH; reg++)
+	{
+		value = SHIFT_IN_Byte();
+
+		/* Add the Changed Inputs to the Changes */
+		if (value != SHIFT_CHAIN_InputImage[reg])
+		{
+			SHIFT_CHAIN_InputChanges[reg] |= value ^ SHIFT_CHAIN_InputImage[reg];
+			SHIFT_CHAIN_InputImage[reg] = value;
+			changed = true;
+		}
+	}
+
+	#endif
+
+	return changed;
+}
+
+
+
+
+
+/*
+ * @brief Gets an input of the 74HC165 chain from the last snapshot.
+ *
+ * @param input: Input number ( register * 8 + bit ).
+ *
+ * @return (uint8) HIGH or LOW.
+ */
+uint8 SHIFT_CHAIN_GetInput(uint8 input)
+{
+
+	#if SHIFT_IN_CHAIN_LENGTH > 0
+
+	/* Check that the Input Number is Valid */
+	if (input < SHIFT_IN_CHAIN_LENGTH * 8)
+	{
+		return GET_BIT(SHIFT_CHAIN_InputImage[input >> 3], input & 7);
+	}
+
+	#endif
+
+	return LOW;
+}
+
+
+
+
+
+/*
+ * @brief Copies all the inputs of the last snapshot and the inputs that changed since the last call.
+ *
+ * @param inputs:  Array of SHIFT_IN_CHAIN_LENGTH bytes to store the inputs.
+ * @param changes: Array of SHIFT_IN_CHAIN_LENGTH bytes to store the changed inputs (bit set
+ *                 for each input that changed), or NULL. The changes are cleared.
+ *
+ * @return (uint8) true if any input changed since the last call, false otherwise.
+ */
+uint8 SHIFT_CHAIN_GetInputs(uint8 * inputs, uint8 * changes)
+{
+
+	uint8 changed = false;
+
+	#if SHIFT_IN_CHAIN_LENGTH > 0
+
+	/* Copy the Image and the Changes without a Snapshot in Between */
+	uint8 sreg = SREG;
+	CLR_BIT(SREG, I);
+
+	for (uint8 reg = 0; reg < SHIFT_IN_CHAIN_LENGTH; reg++)
+	{
+		inputs[reg] = SHIFT_CHAIN_InputImage[reg];
+
+		if (SHIFT_CHAIN_InputChanges[reg] != 0)
+		{
+			changed = true;
+		}
+
+		if (changes != NULL)
+		{
+			changes[reg] = SHIFT_CHAIN_InputChanges[reg];
+		}
+
+		/* Clear the Read Changes */
+		SHIFT_CHAIN_InputChanges[reg] = 0;
+	}
+
+	SREG = sreg;
+
+	#endif
+
+	return changed;
+}
+
+
+
+
+
+/*
+ * @brief Flushes the outputs and takes an input snapshot.
+ *
+ * This function is called by the timer compare match interrupt with SHIFT_CHAIN_TIMER0 or
+ * SHIFT_CHAIN_TIMER2, for I/O refreshed at a fixed rate. With SHIFT_CHAIN_TIMER_MANUAL call
+ * it from the main loop or from your own periodic interrupt.
+ */
+void SHIFT_CHAIN_Refresh(void)
+{
+	SHIFT_CHAIN_Flush();
+	SHIFT_CHAIN_Snapshot();
+}
@@ -18,9 +18,13 @@
  * - SHIFT_OUT_Byte: Sends one byte of data to the shift register.
  * - SHIFT_OUT_Latch: Latches the shifted-out data to the shift register.
  * - SHIFT_IN_Latch: Latches the shifted-in data from the shift register.
+ * - SHIFT_CHAIN_: Daisy-chained registers with a shadow output image flushed only when it
+ *   changes, and an input snapshot with change detection, refreshed from a timer or by the user.
  *
  * @note
  * - Requires `Shift_config.h` for macro-based configuration.
+ * - With SHIFT_INTERFACE_SPI the bytes are shifted by the hardware SPI (initialize it with
+ *   "SPI_Init()" first), only the load pins use the configured DIO pins.
  *
  * @example for two 74HC595 (Shift-Out):
  * 		SHIFT_OUT_Init();
@@ -108,4 +112,97 @@ void SHIFT_OUT_Latch(void);
 void SHIFT_IN_Latch(void);
 
 
+/*
+ * @brief Initializes the shift register chains.
+ *
+ * This function initializes the pins of the used chains, clears all the outputs,
+ * takes the first input snapshot (without changes) and sets the timer callback.
+ */
+void SHIFT_CHAIN_Init(void);
+
+
+/*
+ * @brief Sets an output of the 74HC595 chain to HIGH in the shadow image.
+ *
+ * The output pin changes at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param output: Output number ( register * 8 + bit ).
+ */
+void SHIFT_CHAIN_SetOutput(uint8 output);
+
+
+/*
+ * @brief Clears an output of the 74HC595 chain to LOW in the shadow image.
+ *
+ * The output pin changes at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param output: Output number ( register * 8 + bit ).
+ */
+void SHIFT_CHAIN_ClearOutput(uint8 output);
+
+
+/*
+ * @brief Writes all the outputs of one 74HC595 of the chain in the shadow image.
+ *
+ * The output pins change at the next SHIFT_CHAIN_Flush() or SHIFT_CHAIN_Refresh().
+ *
+ * @param reg:   Register number in the chain (0 is the one connected to the MCU).
+ * @param value: Value of the register outputs.
+ */
+void SHIFT_CHAIN_WriteByte(uint8 reg, uint8 value);
+
+
+/*
+ * @brief Shifts the shadow image to the 74HC595 chain and latches it once.
+ *
+ * Nothing is shifted if the image did not change since the last flush.
+ *
+ * @return (uint8) true if the image was shifted, false if nothing changed.
+ */
+uint8 SHIFT_CHAIN_Flush(void);
+
+
+/*
+ * @brief Reads all the inputs of the 74HC165 chain at the same time.
+ *
+ * The inputs are latched once and shifted into the input image, and the inputs that
+ * changed since the previous snapshot are added to the changes read by SHIFT_CHAIN_GetInputs().
+ *
+ * @return (uint8) true if any input changed, false otherwise.
+ */
+uint8 SHIFT_CHAIN_Snapshot(void);
+
+
+/*
+ * @brief Gets an input of the 74HC165 chain from the last snapshot.
+ *
+ * @param input: Input number ( register * 8 + bit ).
+ *
+ * @return (uint8) HIGH or LOW.
+ */
+uint8 SHIFT_CHAIN_GetInput(uint8 input);
+
+
+/*
+ * @brief Copies all the inputs of the last snapshot and the inputs that changed since the last call.
+ *
+ * @param inputs:  Array of SHIFT_IN_CHAIN_LENGTH bytes to store the inputs.
+ * @param changes: Array of SHIFT_IN_CHAIN_LENGTH bytes to store the changed inputs (bit set
+ *                 for each input that changed), or NULL. The changes are cleared.
+ *
+ * @return (uint8) true if any input changed since the last call, false otherwise.
+ */
+uint8 SHIFT_CHAIN_GetInputs(uint8 * inputs, uint8 * changes);
+
+
+/*
+ * @brief Flushes the outputs and takes an input snapshot.
+ *
+ * This function is called by the timer compare match interrupt with SHIFT_CHAIN_TIMER0 or
+ * SHIFT_CHAIN_TIMER2, for I/O refreshed at a fixed rate. With SHIFT_CHAIN_TIMER_MANUAL call
+ * it from the main loop or from your own periodic interrupt.
+ */
+void SHIFT_CHAIN_Refresh(void);
+
+
 #endif /* SHIFT_H_ */
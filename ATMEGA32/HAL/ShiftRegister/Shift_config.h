@@ -32,6 +32,15 @@
 #define SHIFT_ORDER				SHIFT_MSB_FIRST
 
 
+/*Set the Interface that Shifts the Data:
+ * choose between:
+ * 1. SHIFT_INTERFACE_DIO					<--the default (any pins, about 80 kbit/s)
+ * 2. SHIFT_INTERFACE_SPI					(up to F_CPU / 2, the clock and data pins are fixed:
+ * 											 SCK (PB7) → SHCP and CP, MOSI (PB5) → DS of 74HC595, MISO (PB6) ← Q7 of 74HC165)
+ */
+#define SHIFT_INTERFACE			SHIFT_INTERFACE_DIO
+
+
 
 /*--------------------------   SHIFT OUT CONFIGURATION (74HC595)   --------------------------*/
 
@@ -99,4 +108,132 @@
 /*___________________________________________________________________________________________*/
 
 
+
+/*--------------------------------   CHAIN CONFIGURATION   ---------------------------------*/
+
+/*Set the Number of Daisy-Chained 74HC595 (0 - 16, 0 if no outputs are used by the chain)
+ * Output n of the chain is bit ( n % 8 ) of register ( n / 8 ), register 0 is the one connected to the MCU
+ */
+#define SHIFT_OUT_CHAIN_LENGTH	1
+
+
+/*Set the Number of Daisy-Chained 74HC165 (0 - 16, 0 if no inputs are used by the chain)
+ * Input n of the chain is bit ( n % 8 ) of register ( n / 8 ), register 0 is the one connected to the MCU
+ */
+#define SHIFT_IN_CHAIN_LENGTH	1
+
+
+/*Set the Timer that Refreshes the Chains:
+ * The timer must be initialized manually in CTC mode with the compare match interrupt enabled
+ * choose between:
+ * 1. SHIFT_CHAIN_TIMER_MANUAL				<--the default (call SHIFT_CHAIN_Refresh() yourself)
+ * 2. SHIFT_CHAIN_TIMER0
+ * 3. SHIFT_CHAIN_TIMER2
+ */
+#define SHIFT_CHAIN_TIMER		SHIFT_CHAIN_TIMER_MANUAL
+/*___________________________________________________________________________________________*/
+
+
+
+/* Error checking for invalid configurations */
+#if ( SHIFT_OUT_CHAIN_LENGTH > SHIFT_CHAIN_MAX_LENGTH ) || ( SHIFT_IN_CHAIN_LENGTH > SHIFT_CHAIN_MAX_LENGTH )
+	#error "the SHIFT_OUT_CHAIN_LENGTH or SHIFT_IN_CHAIN_LENGTH value not in range"
+#endif
+
+#if   SHIFT_CHAIN_TIMER == SHIFT_CHAIN_TIMER0
+
+	#include "../../MCAL/TIMER0/TIMER0.h"
+
+	/* You must initialize Timer0 manually "TIMER0_Init()" before using the chain refresh */
+	#ifndef TIMER0_IN_HAL
+	#define TIMER0_IN_HAL
+		#warning "⚠️ Initialize Timer0 manually before using the shift register chain refresh."
+	#endif
+
+	/* Only one driver can use the Timer0 compare match */
+	#ifdef TIMER0_COMP_CLAIMED
+		#error "The Timer0 compare match is used by another driver, change SHIFT_CHAIN_TIMER"
+	#endif
+	#define TIMER0_COMP_CLAIMED
+
+	/* Configure Timer0 to CTC mode */
+	#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+		#warning "⚠️ Configure Timer0 in CTC mode."
+	#endif
+
+	/* Enable Timer0 compare match interrupt */
+	#if TIMER0_COMP_INT_STATUS != TIMER0_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer0 compare match interrupt."
+	#endif
+
+#elif SHIFT_CHAIN_TIMER == SHIFT_CHAIN_TIMER2
+
+	#include "../../MCAL/TIMER2/TIMER2.h"
+
+	/* You must initialize Timer2 manually "TIMER2_Init()" before using the chain refresh */
+	#ifndef TIMER2_IN_HAL
+	#define TIMER2_IN_HAL
+		#warning "⚠️ Initialize Timer2 manually before using the shift register chain refresh."
+	#endif
+
+	/* Only one driver can use the Timer2 compare match */
+	#ifdef TIMER2_COMP_CLAIMED
+		#error "The Timer2 compare match is used by another driver, change SHIFT_CHAIN_TIMER"
+	#endif
+	#define TIMER2_COMP_CLAIMED
+
+	/* Configure Timer2 to CTC mode */
+	#if TIMER2_WAVEFORM_GENERATION_MODE != TIMER2_CTC_MODE
+		#warning "⚠️ Configure Timer2 in CTC mode."
+	#endif
+
+	/* Enable Timer2 compare match interrupt */
+	#if TIMER2_COMP_INT_STATUS != TIMER2_COMP_INT_ENABLE
+		#warning "⚠️ Enable Timer2 compare match interrupt."
+	#endif
+
+#elif SHIFT_CHAIN_TIMER != SHIFT_CHAIN_TIMER_MANUAL
+	#error "Wrong \"SHIFT_CHAIN_TIMER\" configuration option"
+#endif
+
+#if   SHIFT_INTERFACE == SHIFT_INTERFACE_DIO
+
+	/*Clock and latch pulse delay in us*/
+	#define SHIFT_PULSE_DELAY		5
+
+#elif SHIFT_INTERFACE == SHIFT_INTERFACE_SPI
+
+	#include "../../MCAL/SPI/SPI.h"
+
+	/* You must initialize the SPI manually "SPI_Init()" before using this driver */
+	#ifndef SPI_IN_HAL
+	#define SPI_IN_HAL
+		#warning "⚠️ Initialize the SPI manually before using the shift register driver."
+	#endif
+
+	#if SPI_MODE != SPI_MASTER
+		#error "SHIFT_INTERFACE_SPI needs SPI_MASTER"
+	#endif
+
+	#if SPI_INT_STATUS != SPI_INT_DISABLE
+		#error "SHIFT_INTERFACE_SPI waits for each byte, set SPI_INT_DISABLE"
+	#endif
+
+	#if ( ( SHIFT_ORDER == SHIFT_MSB_FIRST ) && ( SPI_DATA_ORDER != SPI_MSB_FIRST ) ) || ( ( SHIFT_ORDER == SHIFT_LSB_FIRST ) && ( SPI_DATA_ORDER != SPI_LSB_FIRST ) )
+		#error "SPI_DATA_ORDER does not match SHIFT_ORDER"
+	#endif
+
+	/* The 74HC595 and 74HC165 shift on the rising clock edge (SPI mode 0) */
+	#if ( SPI_CLOCK_POLARITY != SPI_LEADING_RISING ) || ( SPI_CLOCK_PHASE != SPI_LEADING_SAMPLE )
+		#warning "⚠️ Configure the SPI in mode 0 (SPI_LEADING_RISING, SPI_LEADING_SAMPLE) for the shift registers."
+	#endif
+
+	/*Latch pulse delay in us (the datasheet minimum is 100 ns at 2 V)*/
+	#define SHIFT_PULSE_DELAY		1
+
+#else
+	#error "Wrong \"SHIFT_INTERFACE\" configuration option"
+#endif
+
+
 #endif /* SHIFT_CONFIG_H_ */
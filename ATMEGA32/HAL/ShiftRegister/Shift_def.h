@@ -26,6 +26,22 @@
 /*------------------------------------------   modes    -----------------------------------------*/
 #define SHIFT_LSB_FIRST							0	/*Shift least significant bit first (LSB → MSB)*/
 #define SHIFT_MSB_FIRST							1	/*Shift most  significant bit first (MSB → LSB)*/
+
+#define SHIFT_INTERFACE_DIO						0	/*Bit-bang the clock and data pins with DIO*/
+#define SHIFT_INTERFACE_SPI						1	/*Shift the bytes with the hardware SPI (SCK, MOSI, MISO), the load pins stay on DIO*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Timers that Refresh the Chains*/
+#define SHIFT_CHAIN_TIMER_MANUAL				0	/*SHIFT_CHAIN_Refresh() is called by the user (main loop or any periodic interrupt)*/
+#define SHIFT_CHAIN_TIMER0						1	/*Timer0 compare match interrupt calls SHIFT_CHAIN_Refresh()*/
+#define SHIFT_CHAIN_TIMER2						2	/*Timer2 compare match interrupt calls SHIFT_CHAIN_Refresh()*/
+
+/*Chain Length Limit*/
+#define SHIFT_CHAIN_MAX_LENGTH					16	/*Maximum number of registers in a chain*/
 /*_______________________________________________________________________________________________*/
 
 
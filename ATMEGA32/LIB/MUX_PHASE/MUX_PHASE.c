@@ -0,0 +1,108 @@
+/****************************************************************************
+ * @file    MUX_PHASE.c
+ * @author  Boles Medhat
+ * @brief   Multiplexed Display Phase Module - Lit and Dark Timing
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This module holds the timing shared by the multiplexed display drivers (SEG7 background
+ * refresh and LEDMUX). Each line (digit or row) period is split to a lit part and a dark
+ * part by the brightness, and a timer compare match interrupt steps from part to part and
+ * from line to line. The drivers only output the line that this module selects.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+
+#include "MUX_PHASE.h"
+
+
+/*
+ * @brief Steps a multiplexed display to the next part of the line period.
+ *
+ * After the lit part of a line comes its dark part (unless it is empty), then the next
+ * line starts lit (unless the display is off). The caller outputs phase->Line when
+ * phase->Lit is true and turns all the lines off otherwise.
+ *
+ * @param phase:     Pointer to the refresh state of the display.
+ * @param lines_num: Number of lines of the display.
+ *
+ * @return:          Length of the part that starts, in timer ticks.
+ */
+uint8 MUX_PHASE_Next( MuxPhase * phase , uint8 lines_num )
+{
+
+	/* Check if the Lit Part Ended and the Dark Part of the Period Starts */
+	if( ( phase->Lit == true ) && ( phase->OffTicks != 0 ) )
+	{
+		phase->Lit = false;
+
+		return phase->OffTicks;
+	}
+
+	/* Move to the Next Line */
+	phase->Line = ( phase->Line + 1 < lines_num ) ? ( phase->Line + 1 ) : 0;
+
+	/* Light the Line Unless the Display is Off */
+	if( phase->OnTicks != 0 )
+	{
+		phase->Lit = true;
+
+		return phase->OnTicks;
+	}
+	else
+	{
+		phase->Lit = false;
+
+		return phase->OffTicks;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Splits a line period to the lit and dark parts of a brightness level.
+ *
+ * A part shorter than min_ticks (shorter than the refresh interrupt itself) is joined
+ * to the other part.
+ *
+ * @param period_ticks: Timer ticks of one line period.
+ * @param min_ticks:    Shortest lit or dark part in timer ticks.
+ * @param level:        Brightness level (0 to level_max).
+ * @param level_max:    Full brightness level.
+ * @param on_ticks:     Pointer to store the lit timer ticks.
+ * @param off_ticks:    Pointer to store the dark timer ticks.
+ */
+void MUX_PHASE_Split( uint8 period_ticks , uint8 min_ticks , uint8 level , uint8 level_max , uint8 * on_ticks , uint8 * off_ticks )
+{
+
+	/* Limit the Level to the Full Brightness */
+	if( level > level_max )
+	{
+		level = level_max;
+	}
+
+	/* Split the Line Period to the Lit and Dark Parts */
+	*on_ticks  = ( (uint16)period_ticks * level ) / level_max;
+	*off_ticks = period_ticks - *on_ticks;
+
+	/* A Part Shorter than the Interrupt Itself is Joined to the Other Part */
+	if( *off_ticks < min_ticks )
+	{
+		*on_ticks  = period_ticks;
+		*off_ticks = 0;
+	}
+	else if( ( *on_ticks < min_ticks ) && ( level != 0 ) )
+	{
+		*on_ticks  = min_ticks;
+		*off_ticks = period_ticks - min_ticks;
+	}
+}
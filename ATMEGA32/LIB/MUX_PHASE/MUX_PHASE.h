@@ -0,0 +1,72 @@
+/****************************************************************************
+ * @file    MUX_PHASE.h
+ * @author  Boles Medhat
+ * @brief   Multiplexed Display Phase Header File - Lit and Dark Timing
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This module holds the timing shared by the multiplexed display drivers (SEG7 background
+ * refresh and LEDMUX). Each line (digit or row) period is split to a lit part and a dark
+ * part by the brightness, and a timer compare match interrupt steps from part to part and
+ * from line to line. The drivers only output the line that this module selects.
+ *
+ * The MUX_PHASE module includes the following functionalities:
+ * - Stepping to the next lit or dark part of the line period.
+ * - Splitting the line period by a brightness level, with a minimum part length.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef MUX_PHASE_H_
+#define MUX_PHASE_H_
+
+#include "../STD_TYPES.h"
+
+
+/*Refresh State of a Multiplexed Display*/
+typedef struct
+{
+	volatile uint8 OnTicks;		/*Lit timer ticks of each line period (from the brightness)*/
+	volatile uint8 OffTicks;	/*Dark timer ticks of each line period (from the brightness)*/
+	uint8 Line;					/*The displayed line*/
+	uint8 Lit;					/*true while the displayed line is lit*/
+} MuxPhase;
+
+
+/*
+ * @brief Steps a multiplexed display to the next part of the line period.
+ *
+ * After the lit part of a line comes its dark part (unless it is empty), then the next
+ * line starts lit (unless the display is off). The caller outputs phase->Line when
+ * phase->Lit is true and turns all the lines off otherwise.
+ *
+ * @param phase:     Pointer to the refresh state of the display.
+ * @param lines_num: Number of lines of the display.
+ *
+ * @return           Length of the part that starts, in timer ticks.
+ */
+uint8 MUX_PHASE_Next( MuxPhase * phase , uint8 lines_num );
+
+
+/*
+ * @brief Splits a line period to the lit and dark parts of a brightness level.
+ *
+ * A part shorter than min_ticks (shorter than the refresh interrupt itself) is joined
+ * to the other part.
+ *
+ * @param period_ticks: Timer ticks of one line period.
+ * @param min_ticks:    Shortest lit or dark part in timer ticks.
+ * @param level:        Brightness level (0 to level_max).
+ * @param level_max:    Full brightness level.
+ * @param on_ticks:     Pointer to store the lit timer ticks.
+ * @param off_ticks:    Pointer to store the dark timer ticks.
+ */
+void MUX_PHASE_Split( uint8 period_ticks , uint8 min_ticks , uint8 level , uint8 level_max , uint8 * on_ticks , uint8 * off_ticks );
+
+#endif /* MUX_PHASE_H_ */
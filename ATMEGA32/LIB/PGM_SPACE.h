@@ -0,0 +1,51 @@
+/****************************************************************************
+ * @file    PGM_SPACE.h
+ * @author  Boles Medhat
+ * @brief   Program Memory (Flash) Access Macros Header File
+ * @version 1.0
+ * @date    [2025-10-16]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides the macros to store constant tables in program memory (Flash)
+ * and to read them back byte by byte, for the drivers that keep fonts and glyphs
+ * out of RAM.
+ *
+ * @note
+ * - If <avr/pgmspace.h> is included first, its definitions are used instead.
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef PGM_SPACE_H_
+#define PGM_SPACE_H_
+
+#include "STD_TYPES.h"
+
+
+#ifndef pgm_read_byte
+
+/*Attribute to store variables in program memory (Flash) instead of RAM*/
+#define PROGMEM			__attribute__((__progmem__))
+
+/*Macro to read a byte from program memory (Flash) at the specified address*/
+#define pgm_read_byte(addr)				\
+(__extension__({						\
+    uint16 __addr16 = (uint16)(addr);	\
+    uint8 __result;						\
+    __asm__								\
+    (									\
+        "lpm %0, Z" "\n\t"				\
+        : "=r" (__result)				\
+        : "z" (__addr16)				\
+    );									\
+    __result;							\
+}))
+
+#endif
+
+
+#endif /* PGM_SPACE_H_ */
@@ -29,6 +29,87 @@
 void (*g_ADC_CallBack)(uint16) = NULL;
 
 
+#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+/* The channels of the scan in the scan order */
+const uint8 g_ADC_ScanChannels[ ADC_SCAN_CHANNELS_NUM ] = ADC_SCAN_CHANNELS;
+
+/* Last 10-bit result of each channel */
+volatile uint16 g_ADC_ScanValues[ ADC_SCAN_CHANNELS_NUM ];
+
+/* Rings of the last samples of each channel, all rings move together once per full scan */
+volatile uint16 g_ADC_ScanSamples[ ADC_SCAN_CHANNELS_NUM ][ ADC_SCAN_RING_SIZE ];
+
+/* Ring slot of the running scan and the number of full scans kept in the rings */
+volatile uint8 g_ADC_ScanRingHead;
+volatile uint8 g_ADC_ScanFilled;
+
+/* Index of the channel under conversion in the scan list */
+volatile uint8 g_ADC_ScanIndex;
+
+/* Flag to indicate that the ISR starts the next conversion */
+volatile uint8 g_ADC_ScanRunning = false;
+
+
+
+
+
+/*
+ * @brief Finds the index of a channel in the scan list.
+ *
+ * This function is not intended for direct use by the user.
+ *
+ * @param ADC_channel: The channel to find.
+ *
+ * @return: The index of the channel, ADC_SCAN_CHANNELS_NUM if it is not in the list.
+ */
+static uint8 ADC_SCAN_FindChannel( uint8 ADC_channel )
+{
+
+	uint8 index;
+
+	for( index = 0 ; index < ADC_SCAN_CHANNELS_NUM ; index++ )
+	{
+		if( g_ADC_ScanChannels[ index ] == ADC_channel )
+		{
+			break;
+		}
+	}
+
+	return index;
+}
+
+#elif ADC_ISR_MODE == ADC_ISR_BLOCK
+
+/* The two block buffers, one is filled while the other holds the last full block */
+uint16 g_ADC_BlockBuffers[ 2 ][ ADC_BLOCK_SIZE ];
+
+/* The buffer under filling and the index of the next sample in it */
+volatile uint8 g_ADC_BlockFilling;
+volatile uint16 g_ADC_BlockIndex;
+
+/* The last full block not returned by ADC_BLOCK_GetBlock() yet */
+uint16 * volatile g_ADC_BlockReady = NULL;
+
+/* Pointer to the callback function called when a block is full */
+void (*g_ADC_BlockCallBack)(uint16 *) = NULL;
+
+#elif ADC_ISR_MODE == ADC_ISR_OVERSAMPLE
+
+/* Sum of the samples of the running result and their number */
+volatile uint16 g_ADC_OversampleSum;
+volatile uint8  g_ADC_OversampleCount;
+
+/* Last finished result and the flag to indicate that it was not read yet */
+volatile uint16 g_ADC_OversampleValue;
+volatile uint8  g_ADC_OversampleReady = false;
+
+/* Flag to indicate that the ISR starts the next conversion */
+volatile uint8 g_ADC_OversampleRunning = false;
+
+#endif
+
+
 
 
 
@@ -444,6 +525,420 @@ void ADC_SetCallback( void (*CopyFuncPtr)(uint16) )
 	/* Copy the function pointer */
 	g_ADC_CallBack = CopyFuncPtr;
 }
+#if ADC_ISR_MODE == ADC_ISR_SCAN
+
+
+
+
+
+/*
+ * @brief Starts scanning the channel list in the background.
+ *
+ * This function clears the stored samples and starts the conversion of the first channel
+ * of ADC_SCAN_CHANNELS. Each ADC interrupt stores the result and starts the next channel,
+ * so the cached values are updated without waiting (ADC_ISR_SCAN only).
+ *
+ * @note Do not use the blocking read functions while the scan is running.
+ */
+void ADC_SCAN_Start( void )
+{
+
+	/* Stop the ISR from Starting a New Conversion while Resetting */
+	g_ADC_ScanRunning = false;
+
+	/* Wait for the Running Conversion to End */
+	while( GET_BIT( ADCSRA , ADSC ) );
+
+	/* Start from the First Channel with Empty Rings */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* Drop the Interrupt of the Last Conversion if it is still Pending */
+	SET_BIT( ADCSRA , ADIF );
+
+	g_ADC_ScanIndex = 0;
+	g_ADC_ScanRingHead = 0;
+	g_ADC_ScanFilled = 0;
+
+	for( uint8 index = 0 ; index < ADC_SCAN_CHANNELS_NUM ; index++ )
+	{
+		g_ADC_ScanValues[ index ] = 0;
+	}
+
+	g_ADC_ScanRunning = true;
+
+	SREG = sreg;
+
+	/* Start the Conversion of the First Channel */
+	ADC_OnlyStartConversion( g_ADC_ScanChannels[ 0 ] );
+}
+
+
+
+
+
+/*
+ * @brief Stops scanning the channel list.
+ *
+ * The running conversion ends normally and no new conversion is started.
+ * The cached values are kept.
+ */
+void ADC_SCAN_Stop( void )
+{
+	g_ADC_ScanRunning = false;
+}
+
+
+
+
+
+/*
+ * @brief Returns the last 10-bit result of a scanned channel without waiting.
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ *
+ * @return: The last 10-bit result, ADC_SCAN_NO_VALUE if the channel is not in the list or not converted yet.
+ */
+uint16 ADC_SCAN_GetValue( uint8 ADC_channel )
+{
+
+	uint16 value = ADC_SCAN_NO_VALUE;
+	uint8 index = ADC_SCAN_FindChannel( ADC_channel );
+
+	/* Check that the Channel is in the Scan List */
+	if( index < ADC_SCAN_CHANNELS_NUM )
+	{
+		/* Read the 16-bit Value without the Interrupt Changing it in the Middle */
+		uint8 sreg = SREG;
+		CLR_BIT( SREG , I );
+
+		/* Check that the Channel was Converted since the Scan Started (Nothing Before ADC_SCAN_Start) */
+		if( ( g_ADC_ScanFilled != 0 ) || ( index < g_ADC_ScanIndex ) )
+		{
+			value = g_ADC_ScanValues[ index ];
+		}
+
+		SREG = sreg;
+	}
+
+	return value;
+}
+
+
+
+
+
+/*
+ * @brief Returns the average of the last samples of a scanned channel.
+ *
+ * The average is of the last ADC_SCAN_RING_SIZE samples (or the samples taken until now).
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ *
+ * @return: The 10-bit average, ADC_SCAN_NO_VALUE if the channel is not in the list or not converted yet.
+ */
+uint16 ADC_SCAN_GetAverage( uint8 ADC_channel )
+{
+
+	uint16 samples[ ADC_SCAN_RING_SIZE ];
+	uint16 sum = 0;
+
+	/* Copy the Samples Taken until Now */
+	uint8 count = ADC_SCAN_GetSamples( ADC_channel , samples );
+
+	/* Check that there are Samples */
+	if( count == 0 )
+	{
+		return ADC_SCAN_NO_VALUE;
+	}
+
+	/* Add the Samples (16 x 1023 fits in 16 bits) */
+	for( uint8 sample = 0 ; sample < count ; sample++ )
+	{
+		sum += samples[ sample ];
+	}
+
+	return sum / count;
+}
+
+
+
+
+
+/*
+ * @brief Copies the last samples of a scanned channel from the oldest to the newest.
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ * @param samples:     Array of ADC_SCAN_RING_SIZE elements to receive the 10-bit samples.
+ *
+ * @return: The number of copied samples (0 to ADC_SCAN_RING_SIZE).
+ */
+uint8 ADC_SCAN_GetSamples( uint8 ADC_channel , uint16 * samples )
+{
+
+	uint8 count = 0;
+	uint8 index = ADC_SCAN_FindChannel( ADC_channel );
+
+	/* Check that the Channel is in the Scan List */
+	if( index < ADC_SCAN_CHANNELS_NUM )
+	{
+		/* Copy the Ring without the Interrupt Changing it in the Middle */
+		uint8 sreg = SREG;
+		CLR_BIT( SREG , I );
+
+		uint8 end = g_ADC_ScanRingHead;
+		count = g_ADC_ScanFilled;
+
+		/* A Channel Already Converted in this Pass Holds its Newest Sample at the Ring Head */
+		if( index < g_ADC_ScanIndex )
+		{
+			end = ( end + 1 ) & ( ADC_SCAN_RING_SIZE - 1 );
+
+			if( count < ADC_SCAN_RING_SIZE )
+			{
+				count++;
+			}
+		}
+
+		/* The Oldest Sample is count Samples before the End of the Channel Ring */
+		uint8 slot = ( end - count ) & ( ADC_SCAN_RING_SIZE - 1 );
+
+		for( uint8 sample = 0 ; sample < count ; sample++ )
+		{
+			samples[ sample ] = g_ADC_ScanSamples[ index ][ slot ];
+			slot = ( slot + 1 ) & ( ADC_SCAN_RING_SIZE - 1 );
+		}
+
+		SREG = sreg;
+	}
+
+	return count;
+}
+
+#elif ADC_ISR_MODE == ADC_ISR_BLOCK
+
+
+
+
+
+/*
+ * @brief Starts the block acquisition at ADC_BLOCK_SAMPLE_RATE_HZ.
+ *
+ * This function sets the trigger timer compare value for the sample rate, selects
+ * ADC_BLOCK_CHANNEL and enables the auto trigger. Each timer compare match starts a
+ * conversion, and the ADC interrupt stores the samples in one buffer while the other
+ * buffer holds the last full block (ADC_ISR_BLOCK only).
+ *
+ * @note The timer must be initialized and running before calling this function.
+ */
+void ADC_BLOCK_Start( void )
+{
+
+	/* Stop the Triggers while Resetting */
+	ADC_BLOCK_Stop();
+
+	/* Wait for the Running Conversion to End */
+	while( GET_BIT( ADCSRA , ADSC ) );
+
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* Drop the Interrupt of the Last Conversion if it is still Pending */
+	SET_BIT( ADCSRA , ADIF );
+
+	/* Start Filling the First Buffer without a Ready Block */
+	g_ADC_BlockFilling = 0;
+	g_ADC_BlockIndex = 0;
+	g_ADC_BlockReady = NULL;
+
+	SREG = sreg;
+
+	/* Select the Channel of the Block */
+	ADMUX &= ADC_CHANNEL_clr_msk;
+	ADMUX |= ADC_BLOCK_CHANNEL;
+
+	/* Set the Sample Period and Clear the Flag of the Timer Compare Match (Writing 1 Clears only this Flag) */
+	#if   ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER0_COMP_msk
+
+		TIMER0_SetCompareValue( ADC_BLOCK_TIMER_TOP );
+		TIFR = ( 1 << OCF0 );
+
+	#elif ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER1_COMP_msk
+
+		/* The Timer is Cleared at Compare A, and Compare B at the Same Count Triggers the ADC */
+		TIMER1_SetCompare_A_Value( ADC_BLOCK_TIMER_TOP );
+		TIMER1_SetCompare_B_Value( ADC_BLOCK_TIMER_TOP );
+		TIFR = ( 1 << OCF1B );
+
+	#endif
+
+	/* Each Rising of the Timer Compare Match Flag Starts a Conversion */
+	ADC_AutoTriggerEnable();
+}
+
+
+
+
+
+/*
+ * @brief Stops the block acquisition.
+ *
+ * This function disables the auto trigger, the samples of the unfinished block are dropped.
+ */
+void ADC_BLOCK_Stop( void )
+{
+
+	/* No New Conversions are Triggered */
+	ADC_AutoTriggerDisable();
+}
+
+
+
+
+
+/*
+ * @brief Sets the function called from the ADC interrupt when a block is full.
+ *
+ * The function receives the full block of ADC_BLOCK_SIZE 10-bit samples. It runs inside
+ * the interrupt, so it should only signal the application (long processing delays the
+ * next samples). The block is not changed until the next block is full.
+ *
+ * @param CopyFuncPtr Pointer to the callback function.
+ *        The function must have a uint16 pointer parameter and void return type.
+ */
+void ADC_BLOCK_SetCallback( void (*CopyFuncPtr)(uint16 *) )
+{
+
+	/* Copy the function pointer */
+	g_ADC_BlockCallBack = CopyFuncPtr;
+}
+
+
+
+
+
+/*
+ * @brief Returns the last full block if it was not returned before.
+ *
+ * The block keeps its samples until the next block is full (ADC_BLOCK_SIZE sample periods),
+ * so it must be processed within that time.
+ *
+ * @return: Pointer to ADC_BLOCK_SIZE 10-bit samples, NULL if no new block is ready.
+ */
+uint16 * ADC_BLOCK_GetBlock( void )
+{
+
+	/* Take the Ready Block without the Interrupt Changing it in the Middle */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	uint16 * block = g_ADC_BlockReady;
+	g_ADC_BlockReady = NULL;
+
+	SREG = sreg;
+
+	return block;
+}
+
+#elif ADC_ISR_MODE == ADC_ISR_OVERSAMPLE
+
+
+
+
+
+/*
+ * @brief Starts the oversampling of ADC_OVERSAMPLE_CHANNEL in the background.
+ *
+ * Each ADC interrupt adds the sample and starts the next conversion. Every
+ * ADC_OVERSAMPLE_SAMPLES samples the sum is shifted to an ADC_OVERSAMPLE_BITS result,
+ * which is kept for ADC_OVERSAMPLE_GetValue() and passed to the ADC_SetCallback()
+ * function (ADC_ISR_OVERSAMPLE only).
+ *
+ * @note Do not use the blocking read functions while the oversampling is running.
+ */
+void ADC_OVERSAMPLE_Start( void )
+{
+
+	/* Stop the ISR from Starting a New Conversion while Resetting */
+	g_ADC_OversampleRunning = false;
+
+	/* Wait for the Running Conversion to End */
+	while( GET_BIT( ADCSRA , ADSC ) );
+
+	/* Start a New Sum without a Result */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* Drop the Interrupt of the Last Conversion if it is still Pending */
+	SET_BIT( ADCSRA , ADIF );
+
+	g_ADC_OversampleSum = 0;
+	g_ADC_OversampleCount = 0;
+	g_ADC_OversampleValue = 0;
+	g_ADC_OversampleReady = false;
+	g_ADC_OversampleRunning = true;
+
+	SREG = sreg;
+
+	/* Start the First Conversion */
+	ADC_OnlyStartConversion( ADC_OVERSAMPLE_CHANNEL );
+}
+
+
+
+
+
+/*
+ * @brief Stops the oversampling.
+ *
+ * The running conversion ends normally and no new conversion is started.
+ * The last result is kept.
+ */
+void ADC_OVERSAMPLE_Stop( void )
+{
+	g_ADC_OversampleRunning = false;
+}
+
+
+
+
+
+/*
+ * @brief Checks if a new oversampled result is ready.
+ *
+ * @return: true if a result was finished after the last ADC_OVERSAMPLE_GetValue(), false otherwise.
+ */
+uint8 ADC_OVERSAMPLE_IsReady( void )
+{
+	return g_ADC_OversampleReady;
+}
+
+
+
+
+
+/*
+ * @brief Returns the last finished oversampled result without waiting.
+ *
+ * @return: The last ADC_OVERSAMPLE_BITS result (0 to 2^ADC_OVERSAMPLE_BITS - 1),
+ *          0 if no result is finished yet.
+ */
+uint16 ADC_OVERSAMPLE_GetValue( void )
+{
+
+	/* Read the 16-bit Result without the Interrupt Changing it in the Middle */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	uint16 value = g_ADC_OversampleValue;
+	g_ADC_OversampleReady = false;
+
+	SREG = sreg;
+
+	return value;
+}
+
+#endif
 
 
 
@@ -453,8 +948,14 @@ void ADC_SetCallback( void (*CopyFuncPtr)(uint16) )
  * @brief ISR for the ADC interrupt.
  *
  * This ISR is triggered when an ADC interrupt occurs.
- * It reads the ADC result and passes it to the user-defined callback function,
- * previously registered with ADC_SetCallback().
+ * With ADC_ISR_CALLBACK it reads the ADC result and passes it to the user-defined
+ * callback function, previously registered with ADC_SetCallback().
+ * With ADC_ISR_SCAN it stores the result of the scanned channel and starts the
+ * conversion of the next channel of the scan list.
+ * With ADC_ISR_BLOCK it stores the sample in the filling buffer and swaps the
+ * buffers when the block is full.
+ * With ADC_ISR_OVERSAMPLE it adds the sample to the sum and finishes a result
+ * every ADC_OVERSAMPLE_SAMPLES samples.
  *
  * @see ADC_SetCallback for setting the callback function.
  */
@@ -462,21 +963,158 @@ void __vector_16(void)		__attribute__((signal));
 void __vector_16(void)
 {
 
-	/* Check that the pointer is valid */
-	if(g_ADC_CallBack != NULL)
-	{
+	#if   ADC_ISR_MODE == ADC_ISR_CALLBACK
+
+		/* Check that the pointer is valid */
+		if(g_ADC_CallBack != NULL)
+		{
+
+			/* Call the callback function and return 10 bit ADC value */
+			#if   ADC_ADJUSTMENT == ADC_RIGHT_ADJUSTED
+
+				g_ADC_CallBack( ADC );
+
+			#elif ADC_ADJUSTMENT == ADC_LEFT_ADJUSTED
 
-		/* Call the callback function and return 10 bit ADC value */
+				g_ADC_CallBack( ADC >> 6 );
+
+			#endif
+		}
+
+	#elif ADC_ISR_MODE == ADC_ISR_SCAN
+
+		uint8 index = g_ADC_ScanIndex;
+
+		/* Read the 10 bit Result of the Channel that Ended */
 		#if   ADC_ADJUSTMENT == ADC_RIGHT_ADJUSTED
 
-			g_ADC_CallBack( ADC );
+			uint16 result = ADC;
 
 		#elif ADC_ADJUSTMENT == ADC_LEFT_ADJUSTED
 
-			g_ADC_CallBack( ADC >> 6 );
+			uint16 result = ADC >> 6;
 
 		#endif
-	}
+
+		/* Store the Result as the Last Value and in the Ring of the Channel */
+		g_ADC_ScanValues[ index ] = result;
+		g_ADC_ScanSamples[ index ][ g_ADC_ScanRingHead ] = result;
+
+		/* Move to the Next Channel of the List */
+		index++;
+
+		/* Check if a Full Scan of the List Ended */
+		if( index == ADC_SCAN_CHANNELS_NUM )
+		{
+			index = 0;
+
+			/* Move All the Rings to the Next Slot */
+			g_ADC_ScanRingHead = ( g_ADC_ScanRingHead + 1 ) & ( ADC_SCAN_RING_SIZE - 1 );
+
+			if( g_ADC_ScanFilled < ADC_SCAN_RING_SIZE )
+			{
+				g_ADC_ScanFilled++;
+			}
+		}
+
+		g_ADC_ScanIndex = index;
+
+		/* Start the Conversion of the Next Channel (the Last Conversion has Ended, so the Channel can be Changed) */
+		if( g_ADC_ScanRunning == true )
+		{
+			ADC_OnlyStartConversion( g_ADC_ScanChannels[ index ] );
+		}
+
+	#elif ADC_ISR_MODE == ADC_ISR_BLOCK
+
+		/* Clear the Timer Flag that Triggered this Conversion, so the Next Compare Match Triggers Again */
+		#if   ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER0_COMP_msk
+
+			TIFR = ( 1 << OCF0 );
+
+		#elif ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER1_COMP_msk
+
+			TIFR = ( 1 << OCF1B );
+
+		#endif
+
+		uint8  filling = g_ADC_BlockFilling;
+		uint16 index = g_ADC_BlockIndex;
+
+		/* Store the 10 bit Sample in the Filling Buffer */
+		#if   ADC_ADJUSTMENT == ADC_RIGHT_ADJUSTED
+
+			g_ADC_BlockBuffers[ filling ][ index ] = ADC;
+
+		#elif ADC_ADJUSTMENT == ADC_LEFT_ADJUSTED
+
+			g_ADC_BlockBuffers[ filling ][ index ] = ADC >> 6;
+
+		#endif
+
+		index++;
+
+		/* Check if the Block is Full */
+		if( index == ADC_BLOCK_SIZE )
+		{
+			index = 0;
+
+			/* Fill the Other Buffer while the Full Block is Processed */
+			g_ADC_BlockFilling = filling ^ 1;
+			g_ADC_BlockReady = g_ADC_BlockBuffers[ filling ];
+
+			/* Check that the pointer is valid */
+			if( g_ADC_BlockCallBack != NULL )
+			{
+				g_ADC_BlockCallBack( g_ADC_BlockBuffers[ filling ] );
+			}
+		}
+
+		g_ADC_BlockIndex = index;
+
+	#elif ADC_ISR_MODE == ADC_ISR_OVERSAMPLE
+
+		/* Read the 10 bit Sample */
+		#if   ADC_ADJUSTMENT == ADC_RIGHT_ADJUSTED
+
+			uint16 sample = ADC;
+
+		#elif ADC_ADJUSTMENT == ADC_LEFT_ADJUSTED
+
+			uint16 sample = ADC >> 6;
+
+		#endif
+
+		/* Start the Next Conversion First (the Channel does not Change) */
+		if( g_ADC_OversampleRunning == true )
+		{
+			SET_BIT( ADCSRA , ADSC );
+		}
+
+		uint16 sum = g_ADC_OversampleSum + sample;
+		uint8 count = g_ADC_OversampleCount + 1;
+
+		/* Check if All the Samples of the Result were Added */
+		if( count == ADC_OVERSAMPLE_SAMPLES )
+		{
+			/* Decimation: the Sum of 4^n Samples Shifted by n is the (10 + n)-bit Result */
+			g_ADC_OversampleValue = sum >> ADC_OVERSAMPLE_EXTRA_BITS;
+			g_ADC_OversampleReady = true;
+
+			sum = 0;
+			count = 0;
+
+			/* Check that the pointer is valid */
+			if( g_ADC_CallBack != NULL )
+			{
+				g_ADC_CallBack( g_ADC_OversampleValue );
+			}
+		}
+
+		g_ADC_OversampleSum = sum;
+		g_ADC_OversampleCount = count;
+
+	#endif
 }
 
 
@@ -17,6 +17,9 @@
  * - Combined start-and-read functions for both 8-bit and 10-bit modes.
  * - Auto trigger and interrupt enable/disable control.
  * - User-defined callback registration with result pointer linkage.
+ * - Background scan of a channel list from the ADC interrupt with cached values and sample rings.
+ * - Timer triggered block acquisition at a fixed sample rate into two ping-pong buffers.
+ * - Oversampling and decimation for 11 to 13 bit results with an optional dither signal.
  *
  * This driver is designed for modular and reusable embedded projects.
  *
@@ -167,4 +170,142 @@ void ADC_InterruptDisable( void );
 void ADC_SetCallback( void (*CopyFuncPtr)(uint16) );
 
 
+/*
+ * @brief Starts scanning the channel list in the background.
+ *
+ * This function clears the stored samples and starts the conversion of the first channel
+ * of ADC_SCAN_CHANNELS. Each ADC interrupt stores the result and starts the next channel,
+ * so the cached values are updated without waiting (ADC_ISR_SCAN only).
+ *
+ * @note Do not use the blocking read functions while the scan is running.
+ */
+void ADC_SCAN_Start( void );
+
+
+/*
+ * @brief Stops scanning the channel list.
+ *
+ * The running conversion ends normally and no new conversion is started.
+ * The cached values are kept.
+ */
+void ADC_SCAN_Stop( void );
+
+
+/*
+ * @brief Returns the last 10-bit result of a scanned channel without waiting.
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ *
+ * @return: The last 10-bit result, ADC_SCAN_NO_VALUE if the channel is not in the list or not converted yet.
+ */
+uint16 ADC_SCAN_GetValue( uint8 ADC_channel );
+
+
+/*
+ * @brief Returns the average of the last samples of a scanned channel.
+ *
+ * The average is of the last ADC_SCAN_RING_SIZE samples (or the samples taken until now).
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ *
+ * @return: The 10-bit average, ADC_SCAN_NO_VALUE if the channel is not in the list or not converted yet.
+ */
+uint16 ADC_SCAN_GetAverage( uint8 ADC_channel );
+
+
+/*
+ * @brief Copies the last samples of a scanned channel from the oldest to the newest.
+ *
+ * @param ADC_channel: A channel of ADC_SCAN_CHANNELS (e.g., ADC0, ADC1, etc.).
+ * @param samples:     Array of ADC_SCAN_RING_SIZE elements to receive the 10-bit samples.
+ *
+ * @return: The number of copied samples (0 to ADC_SCAN_RING_SIZE).
+ */
+uint8 ADC_SCAN_GetSamples( uint8 ADC_channel , uint16 * samples );
+
+
+/*
+ * @brief Starts the block acquisition at ADC_BLOCK_SAMPLE_RATE_HZ.
+ *
+ * This function sets the trigger timer compare value for the sample rate, selects
+ * ADC_BLOCK_CHANNEL and enables the auto trigger. Each timer compare match starts a
+ * conversion, and the ADC interrupt stores the samples in one buffer while the other
+ * buffer holds the last full block (ADC_ISR_BLOCK only).
+ *
+ * @note The timer must be initialized and running before calling this function.
+ */
+void ADC_BLOCK_Start( void );
+
+
+/*
+ * @brief Stops the block acquisition.
+ *
+ * This function disables the auto trigger, the samples of the unfinished block are dropped.
+ */
+void ADC_BLOCK_Stop( void );
+
+
+/*
+ * @brief Sets the function called from the ADC interrupt when a block is full.
+ *
+ * The function receives the full block of ADC_BLOCK_SIZE 10-bit samples. It runs inside
+ * the interrupt, so it should only signal the application (long processing delays the
+ * next samples). The block is not changed until the next block is full.
+ *
+ * @param CopyFuncPtr Pointer to the callback function.
+ *        The function must have a uint16 pointer parameter and void return type.
+ */
+void ADC_BLOCK_SetCallback( void (*CopyFuncPtr)(uint16 *) );
+
+
+/*
+ * @brief Returns the last full block if it was not returned before.
+ *
+ * The block keeps its samples until the next block is full (ADC_BLOCK_SIZE sample periods),
+ * so it must be processed within that time.
+ *
+ * @return: Pointer to ADC_BLOCK_SIZE 10-bit samples, NULL if no new block is ready.
+ */
+uint16 * ADC_BLOCK_GetBlock( void );
+
+
+/*
+ * @brief Starts the oversampling of ADC_OVERSAMPLE_CHANNEL in the background.
+ *
+ * Each ADC interrupt adds the sample and starts the next conversion. Every
+ * ADC_OVERSAMPLE_SAMPLES samples the sum is shifted to an ADC_OVERSAMPLE_BITS result,
+ * which is kept for ADC_OVERSAMPLE_GetValue() and passed to the ADC_SetCallback()
+ * function (ADC_ISR_OVERSAMPLE only).
+ *
+ * @note Do not use the blocking read functions while the oversampling is running.
+ */
+void ADC_OVERSAMPLE_Start( void );
+
+
+/*
+ * @brief Stops the oversampling.
+ *
+ * The running conversion ends normally and no new conversion is started.
+ * The last result is kept.
+ */
+void ADC_OVERSAMPLE_Stop( void );
+
+
+/*
+ * @brief Checks if a new oversampled result is ready.
+ *
+ * @return: true if a result was finished after the last ADC_OVERSAMPLE_GetValue(), false otherwise.
+ */
+uint8 ADC_OVERSAMPLE_IsReady( void );
+
+
+/*
+ * @brief Returns the last finished oversampled result without waiting.
+ *
+ * @return: The last ADC_OVERSAMPLE_BITS result (0 to 2^ADC_OVERSAMPLE_BITS - 1),
+ *          0 if no result is finished yet.
+ */
+uint16 ADC_OVERSAMPLE_GetValue( void );
+
+
 #endif /* ADC_H_ */
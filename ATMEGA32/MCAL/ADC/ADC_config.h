@@ -91,39 +91,297 @@
 #define  ADC_COUNTOUT					150
 
 
+/*Set the Work of the ADC Interrupt (with ADC_INT_ENABLE)
+ * choose between:
+ * 1. ADC_ISR_CALLBACK					<--the most used (passes each result to the ADC_SetCallback() function)
+ * 2. ADC_ISR_SCAN						(converts the ADC_SCAN_CHANNELS list in the background, started by ADC_SCAN_Start())
+ * 3. ADC_ISR_BLOCK						(fills blocks of samples at a fixed rate triggered by a timer, started by ADC_BLOCK_Start())
+ * 4. ADC_ISR_OVERSAMPLE				(adds 4^n samples for 11 - 13 bit results, started by ADC_OVERSAMPLE_Start())
+ */
+#define ADC_ISR_MODE					ADC_ISR_CALLBACK
+
+
+/*Set the Channels of the Scan (ADC_ISR_SCAN), in the scan order
+ * Any channels from ADC_def.h (e.g., ADC_Channel_0, ADC_Channel_9)
+ */
+#define ADC_SCAN_CHANNELS				{ ADC_Channel_0 , ADC_Channel_1 }
+
+
+/*Set the Number of Channels in ADC_SCAN_CHANNELS (valid range: 1 - 8)*/
+#define ADC_SCAN_CHANNELS_NUM			2
+
+
+/*Set the Number of Last Samples Kept for each Channel (ADC_ISR_SCAN)
+ * choose between:
+ * 1. 2
+ * 2. 4									<--the most used
+ * 3. 8
+ * 4. 16
+ */
+#define ADC_SCAN_RING_SIZE				4
+
+
+/*Set the Channel of the Block Acquisition (ADC_ISR_BLOCK)
+ * Any channel from ADC_def.h (e.g., ADC_Channel_0, ADC_Channel_9)
+ */
+#define ADC_BLOCK_CHANNEL				ADC_Channel_0
+
+
+/*Set the Number of Samples in a Block (ADC_ISR_BLOCK), valid range: 8 - 256
+ * Two blocks are kept (one filling and one ready), so they use 4 x ADC_BLOCK_SIZE bytes of RAM
+ */
+#define ADC_BLOCK_SIZE					64
+
+
+/*Set the Sample Rate of the Block Acquisition in Hz (ADC_ISR_BLOCK)
+ * The trigger timer compare value is set from it, so it must fit the timer with its prescaler
+ */
+#define ADC_BLOCK_SAMPLE_RATE_HZ		1000
+
+
+/*Set the Channel of the Oversampling (ADC_ISR_OVERSAMPLE)
+ * Any channel from ADC_def.h (e.g., ADC_Channel_0, ADC_Channel_9)
+ */
+#define ADC_OVERSAMPLE_CHANNEL			ADC_Channel_0
+
+
+/*Set the Resolution of the Oversampled Result in Bits (ADC_ISR_OVERSAMPLE)
+ * choose between:
+ * 1. 11								(4 samples per result)
+ * 2. 12								<--the most used (16 samples per result)
+ * 3. 13								(64 samples per result)
+ */
+#define ADC_OVERSAMPLE_BITS				12
+
+
+/*Set the Dither Source of the Oversampling (ADC_ISR_OVERSAMPLE)
+ * The timer output must be initialized by its driver and connected to the input through a
+ * resistor network that adds about 1 LSB, its period should be the time of one result
+ * choose between:
+ * 1. ADC_DITHER_NONE					<--the most used
+ * 2. ADC_DITHER_TIMER0
+ * 3. ADC_DITHER_TIMER2
+ */
+#define ADC_OVERSAMPLE_DITHER			ADC_DITHER_NONE
+
+
 
 /* Automatically select the smallest ADC prescaler that keeps ADC frequency within valid range (50kHz–200kHz) */
 #if		F_CPU/2 <= ADC_FREQUENCY_MAX && F_CPU/2 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_2_msk
+    #define ADC_PRESCALER_DIVIDER		2
 
 #elif	F_CPU/4 <= ADC_FREQUENCY_MAX && F_CPU/4 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_4_msk
+    #define ADC_PRESCALER_DIVIDER		4
 
 #elif	F_CPU/8 <= ADC_FREQUENCY_MAX && F_CPU/8 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_8_msk
+    #define ADC_PRESCALER_DIVIDER		8
 
 #elif	F_CPU/16 <= ADC_FREQUENCY_MAX && F_CPU/16 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_16_msk
+    #define ADC_PRESCALER_DIVIDER		16
 
 #elif	F_CPU/32 <= ADC_FREQUENCY_MAX && F_CPU/32 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_32_msk
+    #define ADC_PRESCALER_DIVIDER		32
 
 #elif	F_CPU/64 <= ADC_FREQUENCY_MAX && F_CPU/64 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_64_msk
+    #define ADC_PRESCALER_DIVIDER		64
 
 #elif	F_CPU/128 <= ADC_FREQUENCY_MAX && F_CPU/128 >= ADC_FREQUENCY_MIN
 
     #define ADC_PRESCALER				ADC_PRESCALER_128_msk
+    #define ADC_PRESCALER_DIVIDER		128
 
 #else
     #error "No valid ADC_PRESCALER found!"
 #endif
 
 
+/* Error checking for invalid configurations */
+#if   ADC_ISR_MODE == ADC_ISR_SCAN
+
+	/* The ISR starts the conversion of each channel */
+	#if ADC_INT_STATUS != ADC_INT_ENABLE
+		#error "ADC_ISR_SCAN needs ADC_INT_ENABLE"
+	#endif
+
+	#if ADC_MODE != ADC_MODE_SINGLE_CONVERSION
+		#error "ADC_ISR_SCAN needs ADC_MODE_SINGLE_CONVERSION"
+	#endif
+
+	#if ( ADC_SCAN_CHANNELS_NUM < 1 ) || ( ADC_SCAN_CHANNELS_NUM > ADC_SCAN_MAX_CHANNELS )
+		#error "the ADC_SCAN_CHANNELS_NUM value not in range"
+	#endif
+
+	#if ( ADC_SCAN_RING_SIZE != 2 ) && ( ADC_SCAN_RING_SIZE != 4 ) && ( ADC_SCAN_RING_SIZE != 8 ) && ( ADC_SCAN_RING_SIZE != 16 )
+		#error "Wrong \"ADC_SCAN_RING_SIZE\" configuration option"
+	#endif
+
+#elif ADC_ISR_MODE == ADC_ISR_BLOCK
+
+	/* The ISR stores each sample */
+	#if ADC_INT_STATUS != ADC_INT_ENABLE
+		#error "ADC_ISR_BLOCK needs ADC_INT_ENABLE"
+	#endif
+
+	/* The timer compare match starts each conversion */
+	#if ADC_MODE != ADC_MODE_AUTO_TRIGGER
+		#error "ADC_ISR_BLOCK needs ADC_MODE_AUTO_TRIGGER"
+	#endif
+
+	#if ( ADC_BLOCK_SIZE < 8 ) || ( ADC_BLOCK_SIZE > 256 )
+		#error "the ADC_BLOCK_SIZE value not in range"
+	#endif
+
+	/* A conversion started by auto trigger takes 13.5 ADC clock cycles */
+	#if ( ADC_BLOCK_SAMPLE_RATE_HZ * 27UL ) > ( ( F_CPU / ADC_PRESCALER_DIVIDER ) * 2UL )
+		#error "ADC_BLOCK_SAMPLE_RATE_HZ is faster than the ADC conversion"
+	#endif
+
+	#if   ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER0_COMP_msk
+
+		#include "../TIMER0/TIMER0.h"
+
+		/* You must initialize Timer0 manually "TIMER0_Init()" before starting the block acquisition */
+		#ifndef TIMER0_IN_HAL
+		#define TIMER0_IN_HAL
+			#warning "⚠️ Initialize Timer0 manually before using the ADC block acquisition."
+		#endif
+
+		/* Only one driver can use the Timer0 compare match */
+		#ifdef TIMER0_COMP_CLAIMED
+			#error "The Timer0 compare match is used by another driver, change ADC_AUTO_TRIG_SRC"
+		#endif
+		#define TIMER0_COMP_CLAIMED
+
+		/* Configure Timer0 to CTC mode */
+		#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+			#warning "⚠️ Configure Timer0 in CTC mode."
+		#endif
+
+		/*Timer compare value of one sample period*/
+		#define ADC_BLOCK_TIMER_TOP		( ( F_CPU / TIMER0_PRESCALER / ADC_BLOCK_SAMPLE_RATE_HZ ) - 1 )
+
+		#if ( ADC_BLOCK_TIMER_TOP < 1 ) || ( ADC_BLOCK_TIMER_TOP > 255 )
+			#error "ADC_BLOCK_SAMPLE_RATE_HZ does not fit Timer0, change it or the timer prescaler"
+		#endif
+
+	#elif ADC_AUTO_TRIG_SRC == ADC_ATS_TIMER1_COMP_msk
+
+		#include "../TIMER1/TIMER1.h"
+
+		/* You must initialize Timer1 manually "TIMER1_Init()" before starting the block acquisition */
+		#ifndef TIMER1_IN_HAL
+		#define TIMER1_IN_HAL
+			#warning "⚠️ Initialize Timer1 manually before using the ADC block acquisition."
+		#endif
+
+		/* Only one driver can use the Timer1 compare match A */
+		#ifdef TIMER1_COMPA_CLAIMED
+			#error "The Timer1 compare match A is used by another driver, change ADC_AUTO_TRIG_SRC"
+		#endif
+		#define TIMER1_COMPA_CLAIMED
+
+		/* Only one driver can use the Timer1 compare match B */
+		#ifdef TIMER1_COMPB_CLAIMED
+			#error "The Timer1 compare match B is used by another driver, change ADC_AUTO_TRIG_SRC"
+		#endif
+		#define TIMER1_COMPB_CLAIMED
+
+		/* Configure Timer1 to CTC mode with OCR1A as TOP (compare B matches at the same count) */
+		#if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_CTC_OCR1A_MODE
+			#warning "⚠️ Configure Timer1 in CTC mode (TOP = OCR1A)."
+		#endif
+
+		/*Timer compare value of one sample period*/
+		#define ADC_BLOCK_TIMER_TOP		( ( F_CPU / TIMER1_PRESCALER / ADC_BLOCK_SAMPLE_RATE_HZ ) - 1 )
+
+		#if ( ADC_BLOCK_TIMER_TOP < 1 ) || ( ADC_BLOCK_TIMER_TOP > 65535 )
+			#error "ADC_BLOCK_SAMPLE_RATE_HZ does not fit Timer1, change it or the timer prescaler"
+		#endif
+
+	#else
+		#error "ADC_ISR_BLOCK needs ADC_ATS_TIMER0_COMP_msk or ADC_ATS_TIMER1_COMP_msk"
+	#endif
+
+#elif ADC_ISR_MODE == ADC_ISR_OVERSAMPLE
+
+	/* The ISR adds each sample and starts the next conversion */
+	#if ADC_INT_STATUS != ADC_INT_ENABLE
+		#error "ADC_ISR_OVERSAMPLE needs ADC_INT_ENABLE"
+	#endif
+
+	#if ADC_MODE != ADC_MODE_SINGLE_CONVERSION
+		#error "ADC_ISR_OVERSAMPLE needs ADC_MODE_SINGLE_CONVERSION"
+	#endif
+
+	#if ( ADC_OVERSAMPLE_BITS < 11 ) || ( ADC_OVERSAMPLE_BITS > 13 )
+		#error "the ADC_OVERSAMPLE_BITS value not in range"
+	#endif
+
+	/*Extra bits over the 10 bits and the number of added samples (4^n, the sum of 64 samples fits in 16 bits)*/
+	#define ADC_OVERSAMPLE_EXTRA_BITS	( ADC_OVERSAMPLE_BITS - 10 )
+	#define ADC_OVERSAMPLE_SAMPLES		( 1 << ( 2 * ADC_OVERSAMPLE_EXTRA_BITS ) )
+
+	#if   ADC_OVERSAMPLE_DITHER == ADC_DITHER_TIMER0
+
+		#include "../TIMER0/TIMER0.h"
+
+		/* You must initialize Timer0 manually "TIMER0_Init()" to output the dither signal */
+		#ifndef TIMER0_IN_HAL
+		#define TIMER0_IN_HAL
+			#warning "⚠️ Initialize Timer0 manually before using the ADC oversampling dither."
+		#endif
+
+		/* Only one driver can use the Timer0 compare match */
+		#ifdef TIMER0_COMP_CLAIMED
+			#error "The Timer0 compare match is used by another driver, change ADC_OVERSAMPLE_DITHER"
+		#endif
+		#define TIMER0_COMP_CLAIMED
+
+		/* The dither signal is the OC0 pin output */
+		#if TIMER0_OC0_MODE == TIMER0_COM_DISCONNECT_OC0
+			#warning "⚠️ Connect the OC0 pin (toggle or PWM) for the ADC oversampling dither."
+		#endif
+
+	#elif ADC_OVERSAMPLE_DITHER == ADC_DITHER_TIMER2
+
+		#include "../TIMER2/TIMER2.h"
+
+		/* You must initialize Timer2 manually "TIMER2_Init()" to output the dither signal */
+		#ifndef TIMER2_IN_HAL
+		#define TIMER2_IN_HAL
+			#warning "⚠️ Initialize Timer2 manually before using the ADC oversampling dither."
+		#endif
+
+		/* Only one driver can use the Timer2 compare match */
+		#ifdef TIMER2_COMP_CLAIMED
+			#error "The Timer2 compare match is used by another driver, change ADC_OVERSAMPLE_DITHER"
+		#endif
+		#define TIMER2_COMP_CLAIMED
+
+		/* The dither signal is the OC2 pin output */
+		#if TIMER2_OC2_MODE == TIMER2_COM_DISCONNECT_OC2
+			#warning "⚠️ Connect the OC2 pin (toggle or PWM) for the ADC oversampling dither."
+		#endif
+
+	#elif ADC_OVERSAMPLE_DITHER != ADC_DITHER_NONE
+		#error "Wrong \"ADC_OVERSAMPLE_DITHER\" configuration option"
+	#endif
+
+#elif ADC_ISR_MODE != ADC_ISR_CALLBACK
+	#error "Wrong \"ADC_ISR_MODE\" configuration option"
+#endif
+
+
 #endif /* ADC_CONFIG_H_ */
@@ -89,6 +89,10 @@
 #define ADC_FREQUENCY_MIN					50000	/*minimum clock frequency ADC can work with (50KHz)*/
 #define ADC_FREQUENCY_MAX					200000	/*maximum clock frequency ADC can work with (200KHz)*/
 
+/*ADC Scan Limits*/
+#define ADC_SCAN_MAX_CHANNELS				8		/*maximum number of channels in the scan list*/
+#define ADC_SCAN_NO_VALUE					0xFFFF	/*returned for a channel that is not in the scan list or not converted yet*/
+
 /*Single Ended Input*/
 #define ADC_Channel_0						0		/*ADC0*/
 #define ADC_Channel_1						1		/*ADC1*/
@@ -163,6 +167,17 @@
 #define ADC_ATS_TIMER1_OVF_msk				0xC0	/*(1100 0000)	Timer/Counter1 Overflow*/
 #define ADC_ATS_TIMER1_CAPT_msk				0xE0	/*(1110 0000)	Timer/Counter1 Capture Event*/
 
+/*ADC Interrupt Work*/
+#define ADC_ISR_CALLBACK					0		/*The ISR passes each result to the callback function*/
+#define ADC_ISR_SCAN						1		/*The ISR stores each result and converts the next channel of the scan list*/
+#define ADC_ISR_BLOCK						2		/*The ISR fills blocks of timer triggered samples in two buffers (ping-pong)*/
+#define ADC_ISR_OVERSAMPLE					3		/*The ISR adds 4^n samples and keeps the (10 + n)-bit result*/
+
+/*ADC Oversampling Dither Source*/
+#define ADC_DITHER_NONE						0		/*No dither signal (the input noise must be 1 LSB or more)*/
+#define ADC_DITHER_TIMER0					1		/*The OC0 pin output adds a small dither signal to the input through a resistor network*/
+#define ADC_DITHER_TIMER2					2		/*The OC2 pin output adds a small dither signal to the input through a resistor network*/
+
 /*ADC prescaler*/
 #define ADC_PRESCALER_2_msk					0x00	/*ADC Frequency = F_CPU / 2	  (CLK/2)*/
 #define ADC_PRESCALER_4_msk					0x02	/*ADC Frequency = F_CPU / 4	  (CLK/4)*/
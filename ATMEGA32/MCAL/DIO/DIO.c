@@ -481,3 +481,362 @@ void DIO_SetLowerNibble( uint8 dio_port , uint8 nibble_value )
 
 
 
+/*
+ * @brief Writes the masked bits of a register in one read-modify-write that an interrupt cannot split.
+ *
+ * This function is not intended for direct use by the user. The global interrupt is disabled
+ * only if it is enabled (it is already disabled inside an ISR), and a full mask is written
+ * without reading the register.
+ *
+ * @param reg:   Pointer to the register.
+ * @param mask:  Bits to be written.
+ * @param value: Bit values.
+ */
+static void DIO_WriteRegisterMasked( volatile uint8 * reg , uint8 mask , uint8 value )
+{
+
+	/* Check if All the Bits are Written (no Read-Modify-Write Needed) */
+	if( mask == 0xFF )
+	{
+		*reg = value;
+	}
+
+	/* Check if the Global Interrupt is Enabled (Main Context) */
+	else if( GET_BIT( SREG , I ) == 1 )
+	{
+		/* Disable the Global Interrupt During the Read-Modify-Write */
+		CLR_BIT( SREG , I );
+
+		*reg = ( *reg & ~mask ) | ( value & mask );
+
+		/* Enable the Global Interrupt Again */
+		SET_BIT( SREG , I );
+	}
+	else
+	{
+		/* The Global Interrupt is Already Disabled (ISR or Critical Section) */
+		*reg = ( *reg & ~mask ) | ( value & mask );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the masked pins of a port in one interrupt-safe read-modify-write.
+ *
+ * The pins in the mask take the values of the same bits in the value, the other pins
+ * do not change. If the global interrupt is enabled it is disabled during the
+ * read-modify-write, so an ISR writing the same port cannot be lost.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be written (bit n set for pin n).
+ * @param value:    Pin values aligned with the port bits.
+ */
+void DIO_WritePortMasked( uint8 dio_port , uint8 mask , uint8 value )
+{
+
+	/* Check if the DIO Port is Valid */
+	if( dio_port <= DIO_PORTD )
+	{
+		/* Write the Masked Pins of the Port Register */
+		DIO_WriteRegisterMasked( & DIO_PORT_REG( dio_port ) , mask , value );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets the masked pins of a port to HIGH in one interrupt-safe operation.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be set (bit n set for pin n).
+ */
+void DIO_SetPins( uint8 dio_port , uint8 mask )
+{
+	DIO_WritePortMasked( dio_port , mask , HIGH_PORT );
+}
+
+
+
+
+
+/*
+ * @brief Clears the masked pins of a port to LOW in one interrupt-safe operation.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be cleared (bit n set for pin n).
+ */
+void DIO_ClearPins( uint8 dio_port , uint8 mask )
+{
+	DIO_WritePortMasked( dio_port , mask , LOW_PORT );
+}
+
+
+
+
+
+/*
+ * @brief Sets the direction of all the pins of a pin group in one interrupt-safe operation.
+ *
+ * @param group:         Pointer to the pin group.
+ * @param pin_direction: Direction [ INPUT , OUTPUT , INPUT_PULLUP ].
+ */
+void DIO_SetPinGroupDirection( const DIO_PinGroup * group , uint8 pin_direction )
+{
+
+	/* Check if the DIO Port is Valid */
+	if( group->port <= DIO_PORTD )
+	{
+		if( pin_direction == OUTPUT )
+		{
+			/* Set the Group Pins as Output */
+			DIO_WriteRegisterMasked( & DIO_DDR_REG( group->port ) , group->mask , OUTPUT_PORT );
+		}
+		else
+		{
+			/* Set the Group Pins as Input */
+			DIO_WriteRegisterMasked( & DIO_DDR_REG( group->port ) , group->mask , INPUT_PORT );
+
+			/* Enable the Pull-Up Resistors for INPUT_PULLUP (INPUT Leaves the PORT Bits as They are) */
+			if( pin_direction == INPUT_PULLUP )
+			{
+				DIO_WriteRegisterMasked( & DIO_PORT_REG( group->port ) , group->mask , HIGH_PORT );
+			}
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes all the pins of a pin group in one interrupt-safe read-modify-write.
+ *
+ * @param group: Pointer to the pin group.
+ * @param value: Pin values aligned with the port bits (the bits outside the group are ignored).
+ */
+void DIO_WritePinGroup( const DIO_PinGroup * group , uint8 value )
+{
+	DIO_WritePortMasked( group->port , group->mask , value );
+}
+
+
+
+
+
+/*
+ * @brief Reads all the pins of a pin group at the same time.
+ *
+ * @param group: Pointer to the pin group.
+ *
+ * @return (uint8) Pin values aligned with the port bits (the bits outside the group are 0).
+ */
+uint8 DIO_ReadPinGroup( const DIO_PinGroup * group )
+{
+
+	/* Check if the DIO Port is Valid */
+	if( group->port <= DIO_PORTD )
+	{
+		/* Read All the Pins at Once and Keep the Group Pins */
+		return DIO_PIN_REG( group->port ) & group->mask;
+	}
+
+	return 0;
+}
+
+
+
+
+
+/*
+ * @brief Initializes a virtual bus and sets the direction of its pins.
+ *
+ * This function fills the per-port tables of the bus from its pins: the pins of the bus on
+ * each port, the logical bits on each port, and the shift between them when the bits of a
+ * port are in pin order (so they are moved with one shift instead of bit by bit).
+ *
+ * @param bus:           Pointer to the bus, with width and pins set.
+ * @param pin_direction: Direction [ INPUT , OUTPUT , INPUT_PULLUP ].
+ *
+ * @example
+ * DIO_Bus data_bus = { 4 , { DIO_BUS_PIN( DIO_PORTA , DIO_PIN6 ) , DIO_BUS_PIN( DIO_PORTA , DIO_PIN7 ) ,
+ *                            DIO_BUS_PIN( DIO_PORTC , DIO_PIN0 ) , DIO_BUS_PIN( DIO_PORTD , DIO_PIN3 ) } };
+ * DIO_BusInit( &data_bus , OUTPUT );
+ */
+void DIO_BusInit( DIO_Bus * bus , uint8 pin_direction )
+{
+
+	/* Check if the Bus Width is Valid */
+	if( ( bus->width == 0 ) || ( bus->width > DIO_BUS_MAX_WIDTH ) )
+	{
+		return;
+	}
+
+	/* Clear the Per-Port Tables */
+	for( uint8 port = DIO_PORTA ; port <= DIO_PORTD ; port++ )
+	{
+		bus->port_mask[ port ] = 0;
+		bus->value_mask[ port ] = 0;
+		bus->shift[ port ] = DIO_BUS_NO_SHIFT;
+	}
+
+	/* Loop on the Logical Bits to Fill the Tables */
+	for( uint8 bit = 0 ; bit < bus->width ; bit++ )
+	{
+		uint8 port = DIO_BUS_PIN_PORT( bus->pins[ bit ] );
+		uint8 pin  = DIO_BUS_PIN_NUMBER( bus->pins[ bit ] );
+		sint8 shift = (sint8)pin - (sint8)bit;
+
+		/* Skip a Pin with an Invalid Port */
+		if( port > DIO_PORTD )
+		{
+			continue;
+		}
+
+		/* Take the Shift of the First Bit on the Port */
+		if( bus->port_mask[ port ] == 0 )
+		{
+			bus->shift[ port ] = shift;
+		}
+
+		/* A Bit with a Different Shift Means the Port Bits are not in Pin Order */
+		else if( bus->shift[ port ] != shift )
+		{
+			bus->shift[ port ] = DIO_BUS_NO_SHIFT;
+		}
+
+		SET_BIT( bus->port_mask[ port ] , pin );
+		SET_BIT( bus->value_mask[ port ] , bit );
+	}
+
+	/* Set the Direction of the Bus Pins of each Port at Once */
+	for( uint8 port = DIO_PORTA ; port <= DIO_PORTD ; port++ )
+	{
+		if( bus->port_mask[ port ] != 0 )
+		{
+			DIO_PinGroup group = { port , bus->port_mask[ port ] };
+
+			DIO_SetPinGroupDirection( &group , pin_direction );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes a value to a virtual bus.
+ *
+ * Each port of the bus is written once with an interrupt-safe masked write, so a bus on
+ * one port changes all its pins at the same time, and a bus on several ports needs one
+ * write per port.
+ *
+ * @param bus:   Pointer to the initialized bus.
+ * @param value: Value of the logical bits (bit 0 goes to the first pin of the bus).
+ */
+void DIO_BusWrite( const DIO_Bus * bus , uint8 value )
+{
+
+	/* Loop on the Ports of the Bus */
+	for( uint8 port = DIO_PORTA ; port <= DIO_PORTD ; port++ )
+	{
+		if( bus->port_mask[ port ] == 0 )
+		{
+			continue;
+		}
+
+		uint8 port_value = 0;
+
+		/* Move the Bits with One Shift if they are in Pin Order */
+		if( bus->shift[ port ] != DIO_BUS_NO_SHIFT )
+		{
+			if( bus->shift[ port ] >= 0 )
+			{
+				port_value = ( value & bus->value_mask[ port ] ) << bus->shift[ port ];
+			}
+			else
+			{
+				port_value = ( value & bus->value_mask[ port ] ) >> -bus->shift[ port ];
+			}
+		}
+
+		/* Else Move the Bits of this Port One by One */
+		else
+		{
+			for( uint8 bit = 0 ; bit < bus->width ; bit++ )
+			{
+				if( ( DIO_BUS_PIN_PORT( bus->pins[ bit ] ) == port ) && GET_BIT( value , bit ) )
+				{
+					SET_BIT( port_value , DIO_BUS_PIN_NUMBER( bus->pins[ bit ] ) );
+				}
+			}
+		}
+
+		/* Write All the Bus Pins of the Port at Once */
+		DIO_WritePortMasked( port , bus->port_mask[ port ] , port_value );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Reads the value of a virtual bus.
+ *
+ * Each port of the bus is read once and its pins are put back in the order of the logical bits.
+ *
+ * @param bus: Pointer to the initialized bus.
+ *
+ * @return (uint8) Value of the logical bits (bit 0 comes from the first pin of the bus).
+ */
+uint8 DIO_BusRead( const DIO_Bus * bus )
+{
+
+	uint8 value = 0;
+
+	/* Loop on the Ports of the Bus */
+	for( uint8 port = DIO_PORTA ; port <= DIO_PORTD ; port++ )
+	{
+		if( bus->port_mask[ port ] == 0 )
+		{
+			continue;
+		}
+
+		/* Read All the Bus Pins of the Port at Once */
+		uint8 port_value = DIO_PIN_REG( port ) & bus->port_mask[ port ];
+
+		/* Move the Bits with One Shift if they are in Pin Order */
+		if( bus->shift[ port ] != DIO_BUS_NO_SHIFT )
+		{
+			if( bus->shift[ port ] >= 0 )
+			{
+				value |= port_value >> bus->shift[ port ];
+			}
+			else
+			{
+				value |= port_value << -bus->shift[ port ];
+			}
+		}
+
+		/* Else Move the Bits of this Port One by One */
+		else
+		{
+			for( uint8 bit = 0 ; bit < bus->width ; bit++ )
+			{
+				if( ( DIO_BUS_PIN_PORT( bus->pins[ bit ] ) == port ) && GET_BIT( port_value , DIO_BUS_PIN_NUMBER( bus->pins[ bit ] ) ) )
+				{
+					SET_BIT( value , bit );
+				}
+			}
+		}
+	}
+
+	return value;
+}
@@ -18,6 +18,9 @@
  * - Setting, reading, and toggling individual pin values.
  * - Setting, reading, and toggling values for all pins in a port.
  * - Handling upper and lower nibbles for ports.
+ * - Interrupt-safe masked writes of several pins and pin groups in one operation.
+ * - Virtual buses of logical bits mapped to any pins on any ports.
+ * - Inline pin functions (`...Fast`) that compile to single bit instructions for constant ports and pins.
  *
  * This driver is designed for modular and reusable embedded projects.
  *
@@ -130,4 +133,188 @@ void DIO_SetUpperNibble( uint8 dio_port , uint8 nibble_value );
 void DIO_SetLowerNibble( uint8 dio_port , uint8 nibble_value );
 
 
+/*
+ * @brief Writes the masked pins of a port in one interrupt-safe read-modify-write.
+ *
+ * The pins in the mask take the values of the same bits in the value, the other pins
+ * do not change. If the global interrupt is enabled it is disabled during the
+ * read-modify-write, so an ISR writing the same port cannot be lost.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be written (bit n set for pin n).
+ * @param value:    Pin values aligned with the port bits.
+ */
+void DIO_WritePortMasked( uint8 dio_port , uint8 mask , uint8 value );
+
+
+/*
+ * @brief Sets the masked pins of a port to HIGH in one interrupt-safe operation.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be set (bit n set for pin n).
+ */
+void DIO_SetPins( uint8 dio_port , uint8 mask );
+
+
+/*
+ * @brief Clears the masked pins of a port to LOW in one interrupt-safe operation.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param mask:     Pins to be cleared (bit n set for pin n).
+ */
+void DIO_ClearPins( uint8 dio_port , uint8 mask );
+
+
+/*
+ * @brief Sets the direction of all the pins of a pin group in one interrupt-safe operation.
+ *
+ * @param group:         Pointer to the pin group.
+ * @param pin_direction: Direction [ INPUT , OUTPUT , INPUT_PULLUP ].
+ */
+void DIO_SetPinGroupDirection( const DIO_PinGroup * group , uint8 pin_direction );
+
+
+/*
+ * @brief Writes all the pins of a pin group in one interrupt-safe read-modify-write.
+ *
+ * @param group: Pointer to the pin group.
+ * @param value: Pin values aligned with the port bits (the bits outside the group are ignored).
+ */
+void DIO_WritePinGroup( const DIO_PinGroup * group , uint8 value );
+
+
+/*
+ * @brief Reads all the pins of a pin group at the same time.
+ *
+ * @param group: Pointer to the pin group.
+ *
+ * @return (uint8) Pin values aligned with the port bits (the bits outside the group are 0).
+ */
+uint8 DIO_ReadPinGroup( const DIO_PinGroup * group );
+
+
+/*
+ * @brief Initializes a virtual bus and sets the direction of its pins.
+ *
+ * This function fills the per-port tables of the bus from its pins: the pins of the bus on
+ * each port, the logical bits on each port, and the shift between them when the bits of a
+ * port are in pin order (so they are moved with one shift instead of bit by bit).
+ *
+ * @param bus:           Pointer to the bus, with width and pins set.
+ * @param pin_direction: Direction [ INPUT , OUTPUT , INPUT_PULLUP ].
+ *
+ * @example
+ * DIO_Bus data_bus = { 4 , { DIO_BUS_PIN( DIO_PORTA , DIO_PIN6 ) , DIO_BUS_PIN( DIO_PORTA , DIO_PIN7 ) ,
+ *                            DIO_BUS_PIN( DIO_PORTC , DIO_PIN0 ) , DIO_BUS_PIN( DIO_PORTD , DIO_PIN3 ) } };
+ * DIO_BusInit( &data_bus , OUTPUT );
+ */
+void DIO_BusInit( DIO_Bus * bus , uint8 pin_direction );
+
+
+/*
+ * @brief Writes a value to a virtual bus.
+ *
+ * Each port of the bus is written once with an interrupt-safe masked write, so a bus on
+ * one port changes all its pins at the same time, and a bus on several ports needs one
+ * write per port.
+ *
+ * @param bus:   Pointer to the initialized bus.
+ * @param value: Value of the logical bits (bit 0 goes to the first pin of the bus).
+ */
+void DIO_BusWrite( const DIO_Bus * bus , uint8 value );
+
+
+/*
+ * @brief Reads the value of a virtual bus.
+ *
+ * Each port of the bus is read once and its pins are put back in the order of the logical bits.
+ *
+ * @param bus: Pointer to the initialized bus.
+ *
+ * @return (uint8) Value of the logical bits (bit 0 comes from the first pin of the bus).
+ */
+uint8 DIO_BusRead( const DIO_Bus * bus );
+
+
+/*
+ * @brief Sets the direction of a specific pin, in one instruction (SBI/CBI) per register when all the parameters are constants.
+ *
+ * @param dio_port: 		 DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param dio_pin: 		 Pin number [ DIO_PIN0 to DIO_PIN7 ].
+ * @param pin_direction: Direction [ INPUT , OUTPUT , INPUT_PULLUP ].
+ *
+ * @note The parameters are not checked, use `DIO_SetPinDirection` when the port or pin is a variable.
+ */
+static inline __attribute__((always_inline)) void DIO_SetPinDirectionFast( uint8 dio_port , uint8 dio_pin , uint8 pin_direction )
+{
+	if( pin_direction == OUTPUT )
+	{
+		SET_BIT( DIO_DDR_REG( dio_port ) , dio_pin );
+	}
+	else
+	{
+		CLR_BIT( DIO_DDR_REG( dio_port ) , dio_pin );
+
+		/* Enable the Pull-Up Resistor for INPUT_PULLUP (INPUT does not Change the PORT Bit, as DIO_SetPinDirection) */
+		if( pin_direction == INPUT_PULLUP )
+		{
+			SET_BIT( DIO_PORT_REG( dio_port ) , dio_pin );
+		}
+	}
+}
+
+
+/*
+ * @brief Sets the value (HIGH or LOW) of a specific pin, in one instruction (SBI/CBI) when all the parameters are constants.
+ *
+ * @param dio_port: 	 DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param dio_pin: 	 Pin number [ DIO_PIN0 to DIO_PIN7 ].
+ * @param pin_value: Pin value [ LOW , HIGH ].
+ *
+ * @note The parameters are not checked, use `DIO_SetPinValue` when the port or pin is a variable.
+ */
+static inline __attribute__((always_inline)) void DIO_SetPinValueFast( uint8 dio_port , uint8 dio_pin , uint8 pin_value )
+{
+	if( pin_value == LOW )
+	{
+		CLR_BIT( DIO_PORT_REG( dio_port ) , dio_pin );
+	}
+	else
+	{
+		SET_BIT( DIO_PORT_REG( dio_port ) , dio_pin );
+	}
+}
+
+
+/*
+ * @brief Gets the current value (HIGH or LOW) of a specific pin, in one instruction (SBIS/SBIC in a condition) when the port and pin are constants.
+ *
+ * @param dio_port: DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param dio_pin:  Pin number [ DIO_PIN0 to DIO_PIN7 ].
+ *
+ * @return (uint8) Logic level of the specified pin [0 or 1].
+ *
+ * @note The parameters are not checked, use `DIO_GetPinValue` when the port or pin is a variable.
+ */
+static inline __attribute__((always_inline)) uint8 DIO_GetPinValueFast( uint8 dio_port , uint8 dio_pin )
+{
+	return GET_BIT( DIO_PIN_REG( dio_port ) , dio_pin );
+}
+
+
+/*
+ * @brief Toggles the current state of a specific pin, with direct register access when the port and pin are constants.
+ *
+ * @param dio_port: Port identifier [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ].
+ * @param dio_pin:  Pin number [ DIO_PIN0 to DIO_PIN7 ].
+ *
+ * @note The ATmega32 cannot toggle a pin by writing its PIN register, so this is a read-modify-write
+ *       of the port register (not interrupt safe for the other pins of the port).
+ */
+static inline __attribute__((always_inline)) void DIO_TogglePinValueFast( uint8 dio_port , uint8 dio_pin )
+{
+	TOG_BIT( DIO_PORT_REG( dio_port ) , dio_pin );
+}
+
+
 #endif
@@ -45,6 +45,33 @@
 #define PINB								*((volatile uint8 *)0x36)	/*Port B Input Pins Address Register*/
 #define PINC								*((volatile uint8 *)0x33)	/*Port C Input Pins Address Register*/
 #define PIND								*((volatile uint8 *)0x30)	/*Port D Input Pins Address Register*/
+
+/*Status Register*/
+#define SREG								*((volatile uint8 *)0x5F)	/*status register*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   BITS    ------------------------------------------*/
+
+/*SREG Registers*/
+#define	I									7	/*Global Interrupt Enable*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   macros    ----------------------------------------*/
+
+/*Registers of a DIO port number [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ], the registers of each port
+ *are 3 addresses below the previous port, so a constant port number gives a constant register address*/
+#define DIO_DDR_REG( dio_port )				( *((volatile uint8 *)( 0x3A - 3 * ( dio_port ) )) )	/*Data Direction Register of the port*/
+#define DIO_PORT_REG( dio_port )			( *((volatile uint8 *)( 0x3B - 3 * ( dio_port ) )) )	/*Data Register of the port*/
+#define DIO_PIN_REG( dio_port )				( *((volatile uint8 *)( 0x39 - 3 * ( dio_port ) )) )	/*Input Pins Address Register of the port*/
+
+/*Pin of a virtual bus bit, holds the port number and the pin number in one byte*/
+#define DIO_BUS_PIN( dio_port , dio_pin )		( ( ( dio_port ) << 3 ) | ( dio_pin ) )
+#define DIO_BUS_PIN_PORT( bus_pin )			( ( bus_pin ) >> 3 )
+#define DIO_BUS_PIN_NUMBER( bus_pin )		( ( bus_pin ) & 0x07 )
 /*_______________________________________________________________________________________________*/
 
 
@@ -69,6 +96,11 @@
 #define DIO_PIN7							7		/*PIN7 for functions parameters*/
 
 
+/*Virtual Bus*/
+#define DIO_BUS_MAX_WIDTH					8		/*Maximum number of logical bits in a virtual bus*/
+#define DIO_BUS_NO_SHIFT					0x7F	/*The bus bits on a port are not in pin order and use the per-bit mapping*/
+
+
 /*PIN values*/
 #define LOW									0		/*Low  value (set Pin by 0)*/
 #define HIGH								1		/*High value (set Pin by 1)*/
@@ -171,4 +203,26 @@
 /*_______________________________________________________________________________________________*/
 
 
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Structure to hold a group of pins on one port, updated or read in one operation*/
+typedef struct {
+	uint8 port;								/*DIO Port [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ]*/
+	uint8 mask;								/*Pins of the group (bit n set for pin n)*/
+}DIO_PinGroup;
+
+
+/*Structure to hold a virtual bus (logical bits mapped to any pins on any ports)
+ *Set width and pins only, the per-port tables are filled by DIO_BusInit()*/
+typedef struct {
+	uint8 width;							/*Number of logical bits [ 1 to DIO_BUS_MAX_WIDTH ]*/
+	uint8 pins[ DIO_BUS_MAX_WIDTH ];		/*Pin of each logical bit from bit 0, use DIO_BUS_PIN( port , pin )*/
+	uint8 port_mask[ 4 ];					/*Pins of the bus on each port*/
+	uint8 value_mask[ 4 ];					/*Logical bits of the bus on each port*/
+	sint8 shift[ 4 ];						/*Left shift from the logical bits to the pins of each port, or DIO_BUS_NO_SHIFT*/
+}DIO_Bus;
+/*_______________________________________________________________________________________________*/
+
+
 #endif /* DIO_DIF_H_ */
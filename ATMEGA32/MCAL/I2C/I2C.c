@@ -32,6 +32,30 @@
 /* Pointer to the callback function for the I2C ISR */
 void (* g_I2C_CallBack)(void)= NULL;
 
+/* Pointer to the callback function called when an asynchronous master write ends */
+void (* g_I2C_AsyncCallBack)(void)= NULL;
+
+/* Pointers to hold the addresses of the asynchronous header and data arrays */
+const uint8 * g_I2C_AsyncHeader = NULL;
+const uint8 * g_I2C_AsyncData = NULL;
+
+/* Variables to hold the sizes of the asynchronous header and data arrays */
+uint8  g_I2C_AsyncHeaderSize;
+uint16 g_I2C_AsyncDataSize;
+
+/* Variables to track the current byte index of the asynchronous header and data arrays */
+uint8  g_I2C_AsyncHeaderIndex;
+uint16 g_I2C_AsyncDataIndex;
+
+/* The slave address of the asynchronous master write */
+uint8 g_I2C_AsyncAddress;
+
+/* Flag to indicate that an asynchronous master write is running */
+volatile uint8 g_I2C_AsyncBusy = false;
+
+/* Result of the last asynchronous master write */
+volatile uint8 g_I2C_AsyncResult = SUCCESS;
+
 
 
 
@@ -623,6 +647,210 @@ void I2C_SlaveWrite( uint8 Data )
 
 
 
+/*
+ * @brief Starts an interrupt-driven master write to a slave device.
+ *
+ * This function sends a start condition and returns immediately. The I2C ISR then sends the
+ * slave address with write operation, the header bytes followed by the data bytes, and finally
+ * a stop condition, one byte per interrupt. When the transfer ends (or fails) the I2C interrupt
+ * is disabled again and the callback function is called from the ISR.
+ *
+ * The header is useful for device control or register bytes that precede a large data block
+ * without the need to copy them into the same buffer.
+ *
+ * @example I2C_MasterWriteAsync( 0x3C , Header , 2 , FrameBuffer , 1024 , Flush_Done_Function );
+ *
+ * @param Address:     The 7-bit address of the slave device.
+ * @param Header:      Pointer to the bytes sent first (can be NULL if HeaderSize is 0).
+ * @param HeaderSize:  Number of header bytes.
+ * @param Data:        Pointer to the data bytes sent after the header.
+ * @param DataSize:    Number of data bytes.
+ * @param CopyFuncPtr: Pointer to the callback function called when the transfer ends (can be NULL).
+ *
+ * @return (uint8) SUCCESS if the transfer started, ERROR if another asynchronous transfer is still running.
+ *
+ * @note The buffers must remain valid until the transfer ends, global interrupts must be enabled,
+ *       and no other I2C function can be used while the transfer is running.
+ */
+uint8 I2C_MasterWriteAsync( uint8 Address , const uint8 * Header , uint8 HeaderSize , const uint8 * Data , uint16 DataSize , void (*CopyFuncPtr)(void) )
+{
+
+	/* Check that there is no Running Asynchronous Transfer */
+	if( g_I2C_AsyncBusy == true )
+	{
+		return ERROR;
+	}
+
+
+	/* Copy the Transfer Data */
+	g_I2C_AsyncAddress     = Address;
+	g_I2C_AsyncHeader      = Header;
+	g_I2C_AsyncHeaderSize  = HeaderSize;
+	g_I2C_AsyncData        = Data;
+	g_I2C_AsyncDataSize    = DataSize;
+	g_I2C_AsyncCallBack    = CopyFuncPtr;
+
+	/* Set Indices to First Element */
+	g_I2C_AsyncHeaderIndex = 0;
+	g_I2C_AsyncDataIndex   = 0;
+
+	/* Mark the Transfer as Running */
+	g_I2C_AsyncResult      = SUCCESS;
+	g_I2C_AsyncBusy        = true;
+
+
+	/* Initiate the start condition with the I2C interrupt enabled, the ISR will continue the transfer */
+	TWCR = ( 1 << TWINT ) | ( 1 << TWEA ) | ( 1 << TWSTA ) | ( 1 << TWEN ) | ( 1 << TWIE );
+
+	return SUCCESS;
+}
+
+
+
+
+
+/*
+ * @brief Checks if an asynchronous master write is still running.
+ *
+ * @return (uint8) 1 if the transfer is still running, otherwise 0.
+ */
+uint8 I2C_IsAsyncBusy( void )
+{
+	return g_I2C_AsyncBusy;
+}
+
+
+
+
+
+/*
+ * @brief Gets the result of the last asynchronous master write.
+ *
+ * @return (uint8) SUCCESS if all the bytes were acknowledged by the slave, ERROR otherwise.
+ */
+uint8 I2C_GetAsyncResult( void )
+{
+	return g_I2C_AsyncResult;
+}
+
+
+
+
+
+/*
+ * @brief Ends the asynchronous master write and calls its callback function.
+ *
+ * This function is not intended for direct use by the user.
+ */
+static void I2C_AsyncEnd( void )
+{
+
+	/* Mark the Transfer as Ended */
+	g_I2C_AsyncBusy = false;
+
+	/* Check that the pointer is valid */
+	if( g_I2C_AsyncCallBack != NULL )
+	{
+		/* Call The pointer to function */
+		g_I2C_AsyncCallBack();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Handles one step of the asynchronous master write.
+ *
+ * This function is not intended for direct use by the user. It is called by the I2C ISR
+ * after every start condition, address or data byte, sends the next byte of the transfer,
+ * and ends the transfer with a stop condition after the last byte or on a NACK or bus error.
+ * When the arbitration is lost the bus belongs to the other master, so it is released
+ * without a stop condition.
+ */
+static void I2C_AsyncHandler( void )
+{
+
+	/* Check the status code */
+	switch (TWSR & I2C_STATUS_msk)
+	{
+		case I2C_START_TRANSMITTED_SC:
+		case I2C_REPEATED_START_SC:
+
+			/* Set slave address to indicate a write operation */
+			TWDR = ( g_I2C_AsyncAddress << 1 ) | I2C_WRITE;
+
+			/* End the start condition and clear the interrupt flag to allow the next operation */
+			TWCR = ( 1 << TWINT ) | ( 1 << TWEA ) | ( 1 << TWEN ) | ( 1 << TWIE );
+			return;
+
+		case I2C_SLAW_ACK_SC:
+		case I2C_DATA_TRANSMITTED_ACK_SC:
+
+			/* Send the next header byte, then the next data byte */
+			if( g_I2C_AsyncHeaderIndex < g_I2C_AsyncHeaderSize )
+			{
+				TWDR = g_I2C_AsyncHeader[ g_I2C_AsyncHeaderIndex++ ];
+			}
+			else if( g_I2C_AsyncDataIndex < g_I2C_AsyncDataSize )
+			{
+				TWDR = g_I2C_AsyncData[ g_I2C_AsyncDataIndex++ ];
+			}
+			else
+			{
+				/* All the bytes are sent, end the transfer */
+				break;
+			}
+
+			/* Clear the interrupt flag to allow the next operation */
+			TWCR = ( 1 << TWINT ) | ( 1 << TWEA ) | ( 1 << TWEN ) | ( 1 << TWIE );
+			return;
+
+		case I2C_ARBITRATION_LOST_SC:
+
+			/* Release the bus to the other master without a stop condition and disable the I2C interrupt */
+			TWCR = ( 1 << TWINT ) | ( 1 << TWEA ) | ( 1 << TWEN );
+
+			g_I2C_AsyncResult = ERROR;
+			I2C_AsyncEnd();
+			return;
+
+		case I2C_ARBITRATION_LOST_SLA_W_SC:
+		case I2C_ARBITRATION_LOST_GCALL_ACK_SC:
+		case I2C_ARBITRATION_LOST_SLA_R_SC:
+
+			/* Arbitration lost and this module is addressed as a slave, the interrupt flag
+			 * is left set so the slave operation is served by the I2C callback function
+			 * (or by polling when there is no callback function) */
+			if( g_I2C_CallBack == NULL )
+			{
+				/* Disable the I2C interrupt (writing 0 to TWINT keeps the flag set) */
+				TWCR = ( 1 << TWEA ) | ( 1 << TWEN );
+			}
+
+			g_I2C_AsyncResult = ERROR;
+			I2C_AsyncEnd();
+			return;
+
+		default:
+
+			/* NACK or bus error */
+			g_I2C_AsyncResult = ERROR;
+			break;
+	}
+
+
+	/* Initiate the stop condition and disable the I2C interrupt */
+	TWCR = ( 1 << TWINT ) | ( 1 << TWEA ) | ( 1 << TWSTO ) | ( 1 << TWEN );
+
+	I2C_AsyncEnd();
+}
+
+
+
+
+
 /*
  * @brief Sets a callback function for a I2C interrupt.
  *
@@ -653,16 +881,25 @@ void I2C_SetCallback( void (*CopyFuncPtr)(void) )
  * @brief ISR for the I2C interrupt.
  *
  * This ISR is triggered when a I2C interrupt occurs.
- * It calls the user-defined callback function set by the I2C_SetCallback function.
+ * If an asynchronous master write is running, it continues the transfer,
+ * otherwise it calls the user-defined callback function set by the I2C_SetCallback function.
  *
  * @see I2C_SetCallback for setting the callback function.
+ * @see I2C_MasterWriteAsync for starting an asynchronous master write.
  */
 void __vector_19 (void)		__attribute__ ((signal)) ;
 void __vector_19 (void)
 {
 
+	/* Check if an asynchronous master write is running */
+	if( g_I2C_AsyncBusy == true )
+	{
+		/* Continue the transfer */
+		I2C_AsyncHandler();
+	}
+
 	/* Check that the pointer is valid */
-	if(g_I2C_CallBack != NULL)
+	else if(g_I2C_CallBack != NULL)
 	{
 		/* Call The pointer to function */
 		g_I2C_CallBack();
@@ -18,6 +18,7 @@
  * - Slave mode operations (receive/write data based on master requests).
  * - Error handling for common I2C failure cases.
  * - Interrupt enable/disable and user-defined callback support.
+ * - Interrupt-driven (non-blocking) master write with a completion callback.
  * - Real-time status checks for communication stages and modes.
  *
  * This driver is designed for modular and reusable embedded projects.
@@ -229,6 +230,50 @@ uint8 I2C_SlaveRead( void );
 void I2C_SlaveWrite( uint8 Data );
 
 
+/*
+ * @brief Starts an interrupt-driven master write to a slave device.
+ *
+ * This function sends a start condition and returns immediately. The I2C ISR then sends the
+ * slave address with write operation, the header bytes followed by the data bytes, and finally
+ * a stop condition, one byte per interrupt. When the transfer ends (or fails) the I2C interrupt
+ * is disabled again and the callback function is called from the ISR.
+ *
+ * The header is useful for device control or register bytes that precede a large data block
+ * without the need to copy them into the same buffer.
+ *
+ * @example I2C_MasterWriteAsync( 0x3C , Header , 2 , FrameBuffer , 1024 , Flush_Done_Function );
+ *
+ * @param Address:     The 7-bit address of the slave device.
+ * @param Header:      Pointer to the bytes sent first (can be NULL if HeaderSize is 0).
+ * @param HeaderSize:  Number of header bytes.
+ * @param Data:        Pointer to the data bytes sent after the header.
+ * @param DataSize:    Number of data bytes.
+ * @param CopyFuncPtr: Pointer to the callback function called when the transfer ends (can be NULL).
+ *
+ * @return (uint8) SUCCESS if the transfer started, ERROR if another asynchronous transfer is still running.
+ *
+ * @note The buffers must remain valid until the transfer ends, global interrupts must be enabled,
+ *       and no other I2C function can be used while the transfer is running.
+ */
+uint8 I2C_MasterWriteAsync( uint8 Address , const uint8 * Header , uint8 HeaderSize , const uint8 * Data , uint16 DataSize , void (*CopyFuncPtr)(void) );
+
+
+/*
+ * @brief Checks if an asynchronous master write is still running.
+ *
+ * @return (uint8) 1 if the transfer is still running, otherwise 0.
+ */
+uint8 I2C_IsAsyncBusy( void );
+
+
+/*
+ * @brief Gets the result of the last asynchronous master write.
+ *
+ * @return (uint8) SUCCESS if all the bytes were acknowledged by the slave, ERROR otherwise.
+ */
+uint8 I2C_GetAsyncResult( void );
+
+
 /*
  * @brief Sets a callback function for a I2C interrupt.
  *
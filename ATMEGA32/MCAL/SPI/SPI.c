@@ -273,7 +273,7 @@ void SPI_InterruptEnable( void )
  * @param TX_Byte: Byte to send.
  * @return (uint8) Received byte. Returns 0xFF if the transfer times out.
  */
-uint8 SPI_transferByte( uint8 TX_Byte )
+uint8 SPI_TransferByte( uint8 TX_Byte )
 {
 
 	/* transmit one byte data */
@@ -325,9 +325,9 @@ uint8 SPI_transferByte( uint8 TX_Byte )
  *
  * @param TX_Byte: Byte to transmit.
  */
-void SPI_transmitByte( uint8 TX_Byte )
+void SPI_TransmitByte( uint8 TX_Byte )
 {
-	SPI_transferByte( TX_Byte );
+	SPI_TransferByte( TX_Byte );
 }
 
 
@@ -345,7 +345,7 @@ void SPI_transmitByte( uint8 TX_Byte )
  */
 uint8 SPI_ReceiveByte( void )
 {
-	return SPI_transferByte( SPI_DEFAULT_TRANSMIT_DATA );
+	return SPI_TransferByte( SPI_DEFAULT_TRANSMIT_DATA );
 }
 
 
@@ -362,13 +362,13 @@ uint8 SPI_ReceiveByte( void )
  * @param RX_Array:	Pointer to the array to store received data.
  * @param ArraySize:			Number of bytes to transmit/receive.
  */
-void SPI_transferArray( const uint8 * TX_Array , uint8 * RX_Array , uint16 ArraySize )
+void SPI_TransferArray( const uint8 * TX_Array , uint8 * RX_Array , uint16 ArraySize )
 {
 	/* Loop on the array until it end */
 	for(uint16 index = 0 ; index < ArraySize ; index++)
 	{
 		/* Transmit and receive one byte data */
-		RX_Array[index] = SPI_transferByte( TX_Array[index] );
+		RX_Array[index] = SPI_TransferByte( TX_Array[index] );
 	}
 }
 
@@ -384,13 +384,13 @@ void SPI_transferArray( const uint8 * TX_Array , uint8 * RX_Array , uint16 Array
  * @param TX_Array:	Pointer to the array of data to transmit.
  * @param ArraySize:			Number of bytes to transmit.
  */
-void SPI_transmitArray( const uint8 * TX_Array , uint16 ArraySize )
+void SPI_TransmitArray( const uint8 * TX_Array , uint16 ArraySize )
 {
 	/* Loop on the array until it end */
 	for(uint16 index = 0 ; index < ArraySize ; index++)
 	{
 		/* Transmit one byte data */
-		SPI_transferByte( TX_Array[index] );
+		SPI_TransferByte( TX_Array[index] );
 	}
 }
 
@@ -413,7 +413,7 @@ void SPI_ReceiveArray( uint8 * RX_Array , uint16 ArraySize )
 	for(uint16 index = 0 ; index < ArraySize ; index++)
 	{
 		/* Receive one byte data */
-		RX_Array[index] = SPI_transferByte( SPI_DEFAULT_TRANSMIT_DATA );
+		RX_Array[index] = SPI_TransferByte( SPI_DEFAULT_TRANSMIT_DATA );
 	}
 }
 